@@ -4,8 +4,30 @@
 #include <Arduino.h>
 #include <FastLED.h>
 
-// Matrix dimensions for frame buffer interface
+// Matrix dimensions for frame buffer interface (host benches may override it
+// to measure how an effect scales with the canvas)
+#ifndef TOTAL_SIZE
 #define TOTAL_SIZE 32
+#endif
+
+// Mirror symmetry an animation can declare. Bits: 1 = left/right mirror,
+// 2 = top/bottom mirror, 4 = diagonal mirror within the top-left quadrant
+// (same bits as MatrixOrientation's fold mask).
+enum RenderSymmetry : uint8_t {
+    SYMMETRY_NONE = 0,
+    SYMMETRY_HORIZONTAL = 1,   // fundamental region: left half
+    SYMMETRY_VERTICAL = 2,     // top half
+    SYMMETRY_4FOLD = 3,        // top-left quadrant
+    SYMMETRY_8FOLD = 7         // top-left quadrant, pixels with x >= y
+};
+
+// A rectangle of the canvas changed by a partial update (see getDirtyRects)
+struct DirtyRect {
+    uint8_t x, y, w, h;
+};
+
+#define MAX_DIRTY_RECTS 8
+#define DIRTY_FULL_FRAME 0xFF
 
 class Animation {
 public:
@@ -18,6 +40,48 @@ public:
     // MatrixOrientation handles the transformation to physical LED indices.
     virtual void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) = 0;
 
+    // Band-parallel rendering. Animations whose pixels depend only on (x, y, frameTime)
+    // can opt in; renderBand() is then called concurrently from several cores, each
+    // filling a disjoint range of rows [yStart, yEnd).
+    virtual bool isBandParallelSafe() const { return false; }
+    virtual void renderBand(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t yStart, uint8_t yEnd) {
+        renderFrame(buffer, frameTime);
+    }
+
+    // Reduced-resolution rendering. Smooth effects can render a width x height canvas
+    // into the top-left corner of the buffer; the manager upscales it to the full
+    // canvas during the remap. Return false if the animation does not support it.
+    virtual bool renderScaled(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t width, uint8_t height) {
+        return false;
+    }
+
+    // Symmetric rendering. Animations that declare a symmetry are asked to fill only
+    // the width x height fundamental region in the top-left of the buffer (for 8-fold,
+    // only pixels with x >= y are read); the manager mirrors it during the remap.
+    virtual RenderSymmetry getSymmetry() const { return SYMMETRY_NONE; }
+    virtual void renderSymmetric(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t width, uint8_t height) {
+        renderFrame(buffer, frameTime);
+    }
+
+    // Partial updates. Animations that redraw only parts of the persistent
+    // buffer can report the rectangles the last renderFrame() touched: the
+    // manager then remaps just those, and skips the frame entirely when none
+    // changed. Return the number of rects written (0 = nothing changed), or
+    // DIRTY_FULL_FRAME when the whole canvas must be remapped.
+    virtual uint8_t getDirtyRects(DirtyRect* rects, uint8_t maxRects) const { return DIRTY_FULL_FRAME; }
+
+    // Physical-order rendering. Animations with frames already in LED order
+    // (clips baked for this wall) write them straight into leds, skipping the
+    // canvas and the remap. Used only when no scaling or post chain is set;
+    // redraw must rewrite the current frame even if it hasn't advanced.
+    // Returns false if the LEDs didn't change.
+    virtual bool isPhysical() const { return false; }
+    virtual bool renderPhysical(CRGB* leds, uint32_t frameTime, bool redraw) { return false; }
+
+    // Effect-specific figures for the periodic stats line (statsIntervalMs):
+    // write a short summary into out and return its length, 0 = none
+    virtual int formatStats(char* out, size_t len) const { return 0; }
+
     // Unique, human-readable name for selection and diagnostics
     virtual const char* getName() const = 0;
 };
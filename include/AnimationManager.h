@@ -5,8 +5,20 @@
 #include <FastLED.h>
 #include "Animation.h"
 #include "MatrixOrientation.h"
+#include "render/BandWorkerPool.h"
+#include "render/PostProcessor.h"
 
-#define MAX_ANIMATIONS 16
+#define MAX_ANIMATIONS 32
+
+// Timing of the most recent frame, per pipeline stage (microseconds)
+struct FrameStats {
+    uint32_t renderUs;
+    uint32_t postUs;
+    uint32_t postPassUs[MAX_POST_PASSES];   // per pass of the current chain (fused passes: see PostProcessor)
+    uint32_t remapUs;
+    uint16_t remapPixels;   // canvas pixels remapped (less than the canvas for partial updates)
+    uint32_t frames;     // frames rendered since boot
+};
 
 class AnimationManager {
 private:
@@ -16,17 +28,59 @@ private:
     unsigned long lastSwitchMs;
     uint32_t autoCycleMs; // 0 = disabled
 
+    // Reduced-resolution rendering per slot (1 = full resolution)
+    uint8_t renderDivisor[MAX_ANIMATIONS];
+    UpscaleFilter upscaleFilter[MAX_ANIMATIONS];
+
+    // Post-processing chain per slot, run between render and remap
+    PostPass postPasses[MAX_ANIMATIONS][MAX_POST_PASSES];
+    uint8_t postCount[MAX_ANIMATIONS];
+    PostProcessor post;
+
     // Frame buffer for 2D coordinate rendering
     CRGB frameBuffer[TOTAL_SIZE][TOTAL_SIZE];
 
     // Matrix orientation for coordinate transformation
     MatrixOrientation* matrix;
 
+    // Optional band-parallel rendering (1 band = render on the loop task only)
+    BandWorkerPool renderPool;
+    uint32_t bandFrameTime;
+
+    FrameStats stats;
+
+    // leds doesn't hold a complete frame of the current animation yet (after a
+    // switch or a pipeline change), so partial updates can't be used
+    bool fullRemapNeeded;
+
+    static void renderBandThunk(void* ctx, uint8_t yStart, uint8_t yEnd);
+
+    // Fill the whole canvas from a symmetric animation's fundamental region
+    static void expandSymmetry(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], RenderSymmetry symmetry);
+
 public:
     AnimationManager(MatrixOrientation* matrixPtr);
 
     void setAutoCycle(uint32_t intervalMs); // 0 disables
 
+    // Split renderFrame into horizontal bands rendered concurrently, one per core.
+    // Only applies to animations that report isBandParallelSafe().
+    bool setRenderBands(uint8_t bands);
+    uint8_t getRenderBands() const;
+
+    // Render matching animations at TOTAL_SIZE / divisor (1, 2, 4 or 8) and upscale
+    // to the full canvas. Returns false if no animation has that name.
+    bool setRenderScale(const char* name, uint8_t divisor, UpscaleFilter filter);
+
+    // Post-process matching animations with the given chain (empty chain = none).
+    // Returns false if no animation has that name.
+    bool setPostChain(const char* name, const PostPass* passes, uint8_t count);
+
+    const FrameStats& getFrameStats() const { return stats; }
+
+    // Post chain of the current animation (stats.postPassUs lines up with it)
+    uint8_t getCurrentPostChain(const PostPass*& passes) const;
+
     bool registerAnimation(Animation* animation);
     uint8_t getCount() const;
 
@@ -34,9 +88,13 @@ public:
     bool switchToByName(const char* name);
     int8_t getCurrentIndex() const;
     const char* getCurrentName() const;
+    Animation* getCurrentAnimation() const;
 
     void setup();
-    void loop(CRGB* leds);
+
+    // Render and remap one frame; returns false if the LEDs didn't change
+    // (the animation reported no dirty rectangles), so show() can be skipped
+    bool loop(CRGB* leds);
 };
 
 #endif // ANIMATION_MANAGER_H
@@ -6,6 +6,20 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 #include "MatrixOrientation.h"
+#include "render/BandWorkerPool.h"
+#include "render/PostProcessor.h"
+
+#define MAX_ANIMATION_OPTIONS 16
+
+// Per-animation render options from the "animations" object in the config file,
+// keyed by animation name
+struct AnimationOptions {
+    String name;
+    uint8_t renderScale;      // 1 = full resolution, 2 = 16x16, 4 = 8x8, 8 = 4x4
+    UpscaleFilter upscale;    // Filter used to scale back up to the full canvas
+    PostPass post[MAX_POST_PASSES];   // Post-processing chain, applied in order
+    uint8_t postCount;
+};
 
 class ConfigManager {
 private:
@@ -16,6 +30,20 @@ private:
     String defaultAnimationName;
     uint32_t defaultAutoCycleMs;
     String defaultFsAnimationPath;
+    String textFontPath;      // FNT1 font for the text animations ("" = built-in 5x7)
+    uint8_t renderBands;
+    uint32_t statsIntervalMs; // Print pipeline timing to Serial this often (0 = off)
+    uint32_t clipCacheKB;     // PSRAM budget for cached LFX clips (0 = stream only)
+    bool bakeClips;           // Bake the FS clip into LED order for this wall
+    AnimationOptions animationOptions[MAX_ANIMATION_OPTIONS];
+    uint8_t animationOptionCount;
+
+    // Audio input (loaded from JSON "audio" object); empty source = no audio
+    String audioSource;       // "i2s", the LittleFS path of a WAV file, or "none"
+    uint8_t audioBckPin;
+    uint8_t audioWsPin;
+    uint8_t audioDataPin;
+    uint32_t audioSampleRate;
     
     // LED hardware settings (loaded from JSON)
     uint8_t ledDataPin;
@@ -23,6 +51,10 @@ private:
     String ledType;
     String ledColorOrder;
     
+    // Parse the "animations" object
+    void loadAnimationOptions(JsonObject animations);
+    bool parsePostPass(JsonObject json, PostPass& pass, const String& animationName);
+
     // Validation helpers
     bool validateConfig(const PanelConfig& config);
     void applyDefaults(PanelConfig& config);
@@ -69,6 +101,20 @@ public:
     String getDefaultAnimation() const { return defaultAnimationName; }
     uint32_t getAutoCycleMs() const { return defaultAutoCycleMs; }
     String getFsAnimationPath() const { return defaultFsAnimationPath; }
+    String getTextFontPath() const { return textFontPath; }
+    uint8_t getRenderBands() const { return renderBands; }
+    uint32_t getStatsIntervalMs() const { return statsIntervalMs; }
+    uint32_t getClipCacheKB() const { return clipCacheKB; }
+    bool getBakeClips() const { return bakeClips; }
+    uint8_t getAnimationOptionCount() const { return animationOptionCount; }
+    const AnimationOptions& getAnimationOptions(uint8_t index) const { return animationOptions[index]; }
+
+    // Audio input getters
+    String getAudioSource() const { return audioSource; }
+    uint8_t getAudioBckPin() const { return audioBckPin; }
+    uint8_t getAudioWsPin() const { return audioWsPin; }
+    uint8_t getAudioDataPin() const { return audioDataPin; }
+    uint32_t getAudioSampleRate() const { return audioSampleRate; }
     
     // LED hardware settings getters
     uint8_t getLedDataPin() const { return ledDataPin; }
@@ -27,6 +27,17 @@ enum PanelDirection {
     VERTICAL = 1     // Panels arranged vertically (top-bottom, then right)
 };
 
+// Upscaling filters for reduced-resolution rendering
+enum UpscaleFilter {
+    UPSCALE_NEAREST = 0,
+    UPSCALE_BILINEAR = 1
+};
+
+// Mirror folds for symmetric rendering (combinable)
+#define FOLD_X 0x01          // right half mirrors the left half
+#define FOLD_Y 0x02          // bottom half mirrors the top half
+#define FOLD_DIAGONAL 0x04   // within the top-left quadrant, (x, y) mirrors (y, x) for y > x
+
 // Configuration structure for panel setup
 struct PanelConfig {
     uint8_t panelOrder[NUM_PANELS];      // Physical panel order (which physical panel is at position 0,1,2,3)
@@ -49,6 +60,13 @@ private:
     // Panel colors for identification
     CRGB panelColors[NUM_PANELS];
 
+    // LED index -> source pixel (y * TOTAL_SIZE + x) for renderFolded(), built
+    // for one fold mask at a time; 0xFF = needs rebuilding
+    uint16_t foldGather[TOTAL_LEDS];
+    uint8_t foldGatherMask;
+
+    void buildFoldGather(uint8_t foldMask);
+
 public:
     MatrixOrientation();
     
@@ -63,6 +81,10 @@ public:
     
     // Convert matrix coordinates (x,y) to LED index
     uint16_t getLEDIndex(uint8_t x, uint8_t y);
+
+    // FNV-1a hash of the whole pixel -> LED mapping; clips baked into LED
+    // order store it to tell whether they still match the wall
+    uint32_t getMappingHash();
     
     // Helper: Convert logical panel position to physical panel index (WLED-style)
     uint8_t getPhysicalPanelIndex(uint8_t logicalPanelX, uint8_t logicalPanelY);
@@ -76,7 +98,19 @@ public:
     
     // Render from a flat 1D array (for easier memory management)
     void render(CRGB* pixelArt, CRGB* leds);
-    
+
+    // Remap only the w x h rectangle at (x, y); the rest of leds is left as is
+    void renderRect(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t x, uint8_t y, uint8_t w, uint8_t h, CRGB* leds);
+
+    // Render a srcWidth x srcHeight image from the top-left of pixelArt, upscaled to
+    // the full matrix with nearest or bilinear (8.8 fixed-point) interpolation
+    void renderUpscaled(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t srcWidth, uint8_t srcHeight,
+                        CRGB* leds, UpscaleFilter filter);
+    
+    // Render an image that only holds its fundamental region (see FOLD_*); the mirrored
+    // copies come from a cached gather table, so the remap is one lookup per LED
+    void renderFolded(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t foldMask, CRGB* leds);
+
     // Set panel rotation (0, 90, 180, 270 degrees)
     void setPanelRotation(uint8_t panel, uint8_t rotation);
     
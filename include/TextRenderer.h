@@ -3,18 +3,24 @@
 
 #include <Arduino.h>
 #include <FastLED.h>
+#include "Animation.h"
+#include "render/BitmapFont.h"
+#include "render/TextLayout.h"
 
 // Simple 5x7 bitmap font for LED matrix
 // Each character is 5 columns wide, 7 rows tall
 #define FONT_WIDTH 5
 #define FONT_HEIGHT 7
 #define FONT_SPACING 1  // pixels between characters
+#define FONT_ASCII_GLYPHS 95    // ASCII 32-126
+#define FONT_EXTRA_GLYPHS 37    // Latin-1 letters and symbols, and the euro sign
 
 class TextRenderer {
 private:
-    // 5x7 bitmap font data (ASCII 32-126)
-    // Each character is stored as 5 bytes (35 bits, but we use 7 rows)
-    static const uint8_t fontData[95][5];
+    // 5x7 bitmap font data: ASCII 32-126, then the extra glyphs in codepoint order
+    // Each character is stored as 5 column bytes, bit 0 = top row
+    static const uint8_t fontData[FONT_ASCII_GLYPHS + FONT_EXTRA_GLYPHS][5];
+    static const uint16_t extraCodepoints[FONT_EXTRA_GLYPHS];
 
     // Helper to get character index
     static int getCharIndex(char c) {
@@ -23,11 +29,21 @@ private:
     }
 
 public:
-    // Draw a single character at position (x,y)
+    // The 5 column bytes of a character's glyph (bit 0 = top row)
+    static const uint8_t* getGlyph(char c) { return fontData[getCharIndex(c)]; }
+
+    // The font's glyphs by index, sorted by codepoint (for BitmapFont::builtin())
+    static uint16_t getGlyphCount() { return FONT_ASCII_GLYPHS + FONT_EXTRA_GLYPHS; }
+    static uint16_t getGlyphCodepoint(uint16_t index) {
+        return index < FONT_ASCII_GLYPHS ? 32 + index : extraCodepoints[index - FONT_ASCII_GLYPHS];
+    }
+    static const uint8_t* getGlyphData(uint16_t index) { return fontData[index]; }
+
+    // Draw a single ASCII character at position (x,y)
     // Returns width of character drawn
     static uint8_t drawChar(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], char c, int x, int y, CRGB color);
 
-    // Draw text string starting at position (x,y)
+    // Draw a UTF-8 text string starting at position (x,y)
     // Returns total width of text drawn
     static uint16_t drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int x, int y, CRGB color);
 
@@ -36,253 +52,15 @@ public:
 
     // Center text horizontally on the matrix
     static void drawCenteredText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int y, CRGB color);
-};
-
-// Font data - 5x7 bitmap font
-const uint8_t TextRenderer::fontData[95][5] = {
-    // Space (32)
-    {0x00, 0x00, 0x00, 0x00, 0x00},
-    // ! (33)
-    {0x00, 0x00, 0x5F, 0x00, 0x00},
-    // " (34)
-    {0x00, 0x07, 0x00, 0x07, 0x00},
-    // # (35)
-    {0x14, 0x7F, 0x14, 0x7F, 0x14},
-    // $ (36)
-    {0x24, 0x2A, 0x7F, 0x2A, 0x12},
-    // % (37)
-    {0x23, 0x13, 0x08, 0x64, 0x62},
-    // & (38)
-    {0x36, 0x49, 0x55, 0x22, 0x50},
-    // ' (39)
-    {0x00, 0x05, 0x03, 0x00, 0x00},
-    // ( (40)
-    {0x00, 0x1C, 0x22, 0x41, 0x00},
-    // ) (41)
-    {0x00, 0x41, 0x22, 0x1C, 0x00},
-    // * (42)
-    {0x14, 0x08, 0x3E, 0x08, 0x14},
-    // + (43)
-    {0x08, 0x08, 0x3E, 0x08, 0x08},
-    // , (44)
-    {0x00, 0x50, 0x30, 0x00, 0x00},
-    // - (45)
-    {0x08, 0x08, 0x08, 0x08, 0x08},
-    // . (46)
-    {0x00, 0x60, 0x60, 0x00, 0x00},
-    // / (47)
-    {0x20, 0x10, 0x08, 0x04, 0x02},
-    // 0 (48)
-    {0x3E, 0x51, 0x49, 0x45, 0x3E},
-    // 1 (49)
-    {0x00, 0x42, 0x7F, 0x40, 0x00},
-    // 2 (50)
-    {0x42, 0x61, 0x51, 0x49, 0x46},
-    // 3 (51)
-    {0x21, 0x41, 0x45, 0x4B, 0x31},
-    // 4 (52)
-    {0x18, 0x14, 0x12, 0x7F, 0x10},
-    // 5 (53)
-    {0x27, 0x45, 0x45, 0x45, 0x39},
-    // 6 (54)
-    {0x3C, 0x4A, 0x49, 0x49, 0x30},
-    // 7 (55)
-    {0x01, 0x71, 0x09, 0x05, 0x03},
-    // 8 (56)
-    {0x36, 0x49, 0x49, 0x49, 0x36},
-    // 9 (57)
-    {0x06, 0x49, 0x49, 0x29, 0x1E},
-    // : (58)
-    {0x00, 0x36, 0x36, 0x00, 0x00},
-    // ; (59)
-    {0x00, 0x56, 0x36, 0x00, 0x00},
-    // < (60)
-    {0x08, 0x14, 0x22, 0x41, 0x00},
-    // = (61)
-    {0x14, 0x14, 0x14, 0x14, 0x14},
-    // > (62)
-    {0x00, 0x41, 0x22, 0x14, 0x08},
-    // ? (63)
-    {0x02, 0x01, 0x51, 0x09, 0x06},
-    // @ (64)
-    {0x32, 0x49, 0x79, 0x41, 0x3E},
-    // A (65)
-    {0x7E, 0x11, 0x11, 0x11, 0x7E},
-    // B (66)
-    {0x7F, 0x49, 0x49, 0x49, 0x36},
-    // C (67)
-    {0x3E, 0x41, 0x41, 0x41, 0x22},
-    // D (68)
-    {0x7F, 0x41, 0x41, 0x22, 0x1C},
-    // E (69)
-    {0x7F, 0x49, 0x49, 0x49, 0x41},
-    // F (70)
-    {0x7F, 0x09, 0x09, 0x09, 0x01},
-    // G (71)
-    {0x3E, 0x41, 0x49, 0x49, 0x7A},
-    // H (72)
-    {0x7F, 0x08, 0x08, 0x08, 0x7F},
-    // I (73)
-    {0x00, 0x41, 0x7F, 0x41, 0x00},
-    // J (74)
-    {0x20, 0x40, 0x41, 0x3F, 0x01},
-    // K (75)
-    {0x7F, 0x08, 0x14, 0x22, 0x41},
-    // L (76)
-    {0x7F, 0x40, 0x40, 0x40, 0x40},
-    // M (77)
-    {0x7F, 0x02, 0x0C, 0x02, 0x7F},
-    // N (78)
-    {0x7F, 0x04, 0x08, 0x10, 0x7F},
-    // O (79)
-    {0x3E, 0x41, 0x41, 0x41, 0x3E},
-    // P (80)
-    {0x7F, 0x09, 0x09, 0x09, 0x06},
-    // Q (81)
-    {0x3E, 0x41, 0x51, 0x21, 0x5E},
-    // R (82)
-    {0x7F, 0x09, 0x19, 0x29, 0x46},
-    // S (83)
-    {0x46, 0x49, 0x49, 0x49, 0x31},
-    // T (84)
-    {0x01, 0x01, 0x7F, 0x01, 0x01},
-    // U (85)
-    {0x3F, 0x40, 0x40, 0x40, 0x3F},
-    // V (86)
-    {0x1F, 0x20, 0x40, 0x20, 0x1F},
-    // W (87)
-    {0x3F, 0x40, 0x38, 0x40, 0x3F},
-    // X (88)
-    {0x63, 0x14, 0x08, 0x14, 0x63},
-    // Y (89)
-    {0x07, 0x08, 0x70, 0x08, 0x07},
-    // Z (90)
-    {0x61, 0x51, 0x49, 0x45, 0x43},
-    // [ (91)
-    {0x00, 0x7F, 0x41, 0x41, 0x00},
-    // \ (92)
-    {0x02, 0x04, 0x08, 0x10, 0x20},
-    // ] (93)
-    {0x00, 0x41, 0x41, 0x7F, 0x00},
-    // ^ (94)
-    {0x04, 0x02, 0x01, 0x02, 0x04},
-    // _ (95)
-    {0x40, 0x40, 0x40, 0x40, 0x40},
-    // ` (96)
-    {0x00, 0x01, 0x02, 0x04, 0x00},
-    // a (97)
-    {0x20, 0x54, 0x54, 0x54, 0x78},
-    // b (98)
-    {0x7F, 0x48, 0x44, 0x44, 0x38},
-    // c (99)
-    {0x38, 0x44, 0x44, 0x44, 0x20},
-    // d (100)
-    {0x38, 0x44, 0x44, 0x48, 0x7F},
-    // e (101)
-    {0x38, 0x54, 0x54, 0x54, 0x18},
-    // f (102)
-    {0x08, 0x7E, 0x09, 0x01, 0x02},
-    // g (103)
-    {0x0C, 0x52, 0x52, 0x52, 0x3E},
-    // h (104)
-    {0x7F, 0x08, 0x04, 0x04, 0x78},
-    // i (105)
-    {0x00, 0x44, 0x7D, 0x40, 0x00},
-    // j (106)
-    {0x20, 0x40, 0x44, 0x3D, 0x00},
-    // k (107)
-    {0x7F, 0x10, 0x28, 0x44, 0x00},
-    // l (108)
-    {0x00, 0x41, 0x7F, 0x40, 0x00},
-    // m (109)
-    {0x7C, 0x04, 0x18, 0x04, 0x78},
-    // n (110)
-    {0x7C, 0x08, 0x04, 0x04, 0x78},
-    // o (111)
-    {0x38, 0x44, 0x44, 0x44, 0x38},
-    // p (112)
-    {0x7C, 0x14, 0x14, 0x14, 0x08},
-    // q (113)
-    {0x08, 0x14, 0x14, 0x18, 0x7C},
-    // r (114)
-    {0x7C, 0x08, 0x04, 0x04, 0x08},
-    // s (115)
-    {0x48, 0x54, 0x54, 0x54, 0x20},
-    // t (116)
-    {0x04, 0x3F, 0x44, 0x40, 0x20},
-    // u (117)
-    {0x3C, 0x40, 0x40, 0x20, 0x7C},
-    // v (118)
-    {0x1C, 0x20, 0x40, 0x20, 0x1C},
-    // w (119)
-    {0x3C, 0x40, 0x30, 0x40, 0x3C},
-    // x (120)
-    {0x44, 0x28, 0x10, 0x28, 0x44},
-    // y (121)
-    {0x0C, 0x50, 0x50, 0x50, 0x3C},
-    // z (122)
-    {0x44, 0x64, 0x54, 0x4C, 0x44},
-    // { (123)
-    {0x00, 0x08, 0x36, 0x41, 0x00},
-    // | (124)
-    {0x00, 0x00, 0x7F, 0x00, 0x00},
-    // } (125)
-    {0x00, 0x41, 0x36, 0x08, 0x00},
-    // ~ (126)
-    {0x10, 0x08, 0x18, 0x10, 0x08}
-};
-
-uint8_t TextRenderer::drawChar(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], char c, int x, int y, CRGB color) {
-    int charIndex = getCharIndex(c);
-    const uint8_t* charData = fontData[charIndex];
-
-    // Draw 5x7 character
-    for (int row = 0; row < FONT_HEIGHT; row++) {
-        for (int col = 0; col < FONT_WIDTH; col++) {
-            int bufferX = x + col;
-            int bufferY = y + row;
-
-            // Check bounds
-            if (bufferX >= 0 && bufferX < TOTAL_SIZE && bufferY >= 0 && bufferY < TOTAL_SIZE) {
-                // Check if bit is set in font data (bit 0 = top-left, bit 4 = top-right)
-                if (charData[row] & (1 << (FONT_WIDTH - 1 - col))) {
-                    buffer[bufferY][bufferX] = color;
-                }
-            }
-        }
-    }
 
-    return FONT_WIDTH + FONT_SPACING;
-}
+    // Same, in a loaded font: proportional advances, kerning, anti-aliased
+    // edges blended over the existing pixels
+    static uint16_t drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], BitmapFont& font, const char* text, int x, int y, CRGB color);
 
-uint16_t TextRenderer::drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int x, int y, CRGB color) {
-    int currentX = x;
-    const char* ptr = text;
-
-    while (*ptr) {
-        currentX += drawChar(buffer, *ptr, currentX, y, color);
-        ptr++;
-    }
-
-    return currentX - x; // Return total width
-}
-
-uint16_t TextRenderer::getTextWidth(const char* text) {
-    uint16_t width = 0;
-    const char* ptr = text;
-
-    while (*ptr) {
-        width += FONT_WIDTH + FONT_SPACING;
-        ptr++;
-    }
-
-    return width > 0 ? width - FONT_SPACING : 0; // Don't add spacing after last character
-}
-
-void TextRenderer::drawCenteredText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int y, CRGB color) {
-    uint16_t textWidth = getTextWidth(text);
-    int startX = (TOTAL_SIZE - textWidth) / 2;
-    drawText(buffer, text, startX, y, color);
-}
+    // Draw an already decoded layout (text redrawn every frame, e.g. scrolling)
+    static uint16_t drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const TextLayout& layout, int x, int y, CRGB color);
+    static uint16_t getTextWidth(BitmapFont& font, const char* text) { return font.getTextWidth(text); }
+    static void drawCenteredText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], BitmapFont& font, const char* text, int y, CRGB color);
+};
 
 #endif // TEXT_RENDERER_H
@@ -0,0 +1,148 @@
+#ifndef AUDIO_ANIMATION_H
+#define AUDIO_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "audio/AudioAnalyzer.h"
+
+enum AudioEffect {
+    AUDIO_SPECTRUM = 0,   // Band bars with falling peak caps
+    AUDIO_PULSE = 1       // Rings launched on each beat over a loudness glow
+};
+
+// Visualises the latest AudioAnalyzer snapshot. The analyzer runs in its own
+// task; this only copies its snapshot each frame, so render time is unaffected
+// by the FFT.
+class AudioAnimation : public Animation {
+private:
+    AudioEffect effect;
+    AudioAnalyzer* analyzer;
+    AudioSnapshot snap;
+    uint32_t lastSequence;
+    uint32_t lastBeatCount;
+    uint32_t latencyUs;
+
+    uint8_t peaks[AUDIO_BANDS];     // Peak cap heights in rows
+    uint16_t peakFall[AUDIO_BANDS];  // ms since the cap last moved
+    uint8_t ringRadius[4];          // 0 = free slot, else radius in pixels + 1
+    uint8_t ringHue[4];
+    uint8_t hue;
+    uint32_t lastMs;
+
+    void renderSpectrum(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t elapsed) {
+        const uint8_t barWidth = TOTAL_SIZE / AUDIO_BANDS;
+        for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+            uint8_t height = ((uint16_t)snap.bands[b] * TOTAL_SIZE + 255) >> 8;
+
+            // Caps jump up with the bar and fall with increasing speed
+            if (height >= peaks[b]) {
+                peaks[b] = height;
+                peakFall[b] = 0;
+            } else {
+                peakFall[b] += elapsed;
+                if (peakFall[b] > 120 && peaks[b] > 0) {
+                    peaks[b]--;
+                    peakFall[b] = 60;
+                }
+            }
+
+            for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+                uint8_t row = TOTAL_SIZE - 1 - y;   // Bars grow from the bottom
+                CRGB c = CRGB::Black;
+                if (row < height) c = CHSV(96 - row * 3, 255, 255);
+                else if (row + 1 == peaks[b] && peaks[b] > 0) c = CRGB::White;
+                for (uint8_t i = 0; i < barWidth; i++) buffer[y][b * barWidth + i] = c;
+            }
+        }
+    }
+
+    void renderPulse(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t elapsed, bool beat) {
+        if (beat) {
+            hue += 40;
+            for (uint8_t i = 0; i < 4; i++) {
+                if (ringRadius[i] == 0) {
+                    ringRadius[i] = 1;
+                    ringHue[i] = hue;
+                    break;
+                }
+            }
+        }
+
+        // Rings travel ~24 px/s and fade out past the corners
+        static const uint8_t maxRadius = TOTAL_SIZE * 3 / 4;
+        uint8_t advance = (elapsed * 24 + 500) / 1000;
+        if (advance == 0 && elapsed > 0) advance = 1;
+        for (uint8_t i = 0; i < 4; i++) {
+            if (ringRadius[i] == 0) continue;
+            ringRadius[i] += advance;
+            if (ringRadius[i] > maxRadius) ringRadius[i] = 0;
+        }
+
+        CRGB glow = CHSV(hue, 200, snap.level / 3);
+        const int16_t c2 = TOTAL_SIZE - 1;   // Centre, in half pixels
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            int16_t dy = (int16_t)(y << 1) - c2;
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                int16_t dx = (int16_t)(x << 1) - c2;
+                // Distance in half pixels, octagonal estimate
+                uint16_t ax = abs(dx), ay = abs(dy);
+                uint16_t d = (ax > ay ? ax + (ay >> 1) : ay + (ax >> 1)) >> 1;
+
+                CRGB c = glow;
+                for (uint8_t i = 0; i < 4; i++) {
+                    if (ringRadius[i] == 0) continue;
+                    uint8_t r = ringRadius[i] - 1;
+                    uint8_t dist = d > r ? d - r : r - d;
+                    if (dist < 2) {
+                        uint8_t v = (dist == 0 ? 255 : 96) * (maxRadius - r) / maxRadius;
+                        c += CHSV(ringHue[i], 255, v);
+                    }
+                }
+                buffer[y][x] = c;
+            }
+        }
+    }
+
+public:
+    AudioAnimation(AudioAnalyzer* audio, AudioEffect fx)
+        : effect(fx), analyzer(audio), lastSequence(0), lastBeatCount(0), latencyUs(0), hue(0), lastMs(0) {
+        memset(&snap, 0, sizeof(snap));
+        memset(peaks, 0, sizeof(peaks));
+        memset(peakFall, 0, sizeof(peakFall));
+        memset(ringRadius, 0, sizeof(ringRadius));
+        memset(ringHue, 0, sizeof(ringHue));
+    }
+
+    void setup() override {
+        lastMs = millis();
+        memset(ringRadius, 0, sizeof(ringRadius));
+        if (analyzer && analyzer->read(snap)) lastBeatCount = snap.beatCount;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        uint32_t elapsed = frameTime - lastMs;
+        lastMs = frameTime;
+
+        bool beat = false;
+        if (analyzer && analyzer->read(snap) && snap.sequence != lastSequence) {
+            // Capture-to-render latency of the newest block (this frame is shown right after)
+            latencyUs = micros() - snap.captureUs;
+            lastSequence = snap.sequence;
+            beat = snap.beatCount != lastBeatCount;
+            lastBeatCount = snap.beatCount;
+        }
+
+        if (effect == AUDIO_PULSE) renderPulse(buffer, elapsed, beat);
+        else renderSpectrum(buffer, elapsed);
+    }
+
+    // Age of the audio block shown in the last frame that picked up a new block
+    uint32_t getLatencyUs() const { return latencyUs; }
+
+    const char* getName() const override {
+        return effect == AUDIO_PULSE ? "Beat Pulse" : "Spectrum";
+    }
+};
+
+#endif // AUDIO_ANIMATION_H
@@ -0,0 +1,119 @@
+#ifndef FIRE_ANIMATION_H
+#define FIRE_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/HeatField.h"
+#include "render/Palette.h"
+
+enum FireStyle {
+    FIRE_FLAMES = 0,
+    FIRE_LAVA = 1,
+    FIRE_SMOKE = 2
+};
+
+// Fire, lava and smoke built on a HeatField: cool, move heat, spark, then map
+// heat through a palette. The simulation runs on a fixed timestep and at most
+// FIRE_MAX_STEPS steps per frame, so a slow frame cannot snowball into a
+// catch-up burst that blows the frame budget. Each frame's time is checked
+// against FIRE_BUDGET_US and reported on the stats line.
+#define FIRE_STEP_MS 16
+#define FIRE_MAX_STEPS 2
+#define FIRE_BUDGET_US 2000     // Simulation + palette mapping, an eighth of a 60 fps frame
+
+class FireAnimation : public Animation {
+private:
+    FireStyle style;
+    HeatField field;
+    Palette palette;
+    uint32_t lastStepMs;
+    uint8_t phase;
+    uint32_t renderUs;          // Last frame
+    uint32_t maxRenderUs;
+    uint32_t overBudget;        // Frames over FIRE_BUDGET_US since setup() or resetStats()
+
+    void simulate() {
+        switch (style) {
+            case FIRE_FLAMES:
+                field.cool(40);
+                field.rise(0);
+                field.spark(TOTAL_SIZE - 2, TOTAL_SIZE, TOTAL_SIZE / 2, 255);
+                break;
+            case FIRE_LAVA:
+                field.cool(6);
+                field.diffuse();
+                field.spark(0, TOTAL_SIZE, 2, 220);
+                break;
+            case FIRE_SMOKE:
+                // Sideways drift wanders slowly for curling smoke
+                field.cool(24);
+                field.rise((int8_t)(sin8(phase++) >> 6) - 2);
+                field.spark(TOTAL_SIZE - 2, TOTAL_SIZE, 3, 200);
+                break;
+        }
+    }
+
+public:
+    explicit FireAnimation(FireStyle s) : style(s), lastStepMs(0), phase(0),
+                                             renderUs(0), maxRenderUs(0), overBudget(0) {
+        switch (style) {
+            case FIRE_FLAMES: palette.fromGradient_P(PaletteGradients::Heat); break;
+            case FIRE_LAVA: palette.fromGradient_P(PaletteGradients::Lava); break;
+            case FIRE_SMOKE: palette.fromGradient_P(PaletteGradients::Smoke); break;
+        }
+    }
+
+    void setup() override {
+        field.clear();
+        field.seed(random16());
+        lastStepMs = 0;
+        resetStats();
+    }
+
+    // Start the worst-frame and over-budget counts afresh, keeping the field
+    void resetStats() {
+        maxRenderUs = 0;
+        overBudget = 0;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        uint32_t start = micros();
+        if (lastStepMs == 0) lastStepMs = frameTime - FIRE_STEP_MS;
+
+        uint8_t steps = 0;
+        while (frameTime - lastStepMs >= FIRE_STEP_MS && steps < FIRE_MAX_STEPS) {
+            simulate();
+            lastStepMs += FIRE_STEP_MS;
+            steps++;
+        }
+        // Drop any backlog beyond the per-frame cap instead of catching up later
+        if (frameTime - lastStepMs >= FIRE_STEP_MS) lastStepMs = frameTime;
+
+        field.render(buffer, palette);
+
+        renderUs = micros() - start;
+        if (renderUs > maxRenderUs) maxRenderUs = renderUs;
+        if (renderUs > FIRE_BUDGET_US) overBudget++;
+    }
+
+    uint32_t getRenderUs() const { return renderUs; }
+    uint32_t getMaxRenderUs() const { return maxRenderUs; }
+    uint32_t getOverBudget() const { return overBudget; }
+
+    int formatStats(char* out, size_t len) const override {
+        return snprintf(out, len, "render %lu us (max %lu) of %u us budget, %lu frames over",
+                        (unsigned long)renderUs, (unsigned long)maxRenderUs, FIRE_BUDGET_US,
+                        (unsigned long)overBudget);
+    }
+
+    const char* getName() const override {
+        switch (style) {
+            case FIRE_LAVA: return "Lava";
+            case FIRE_SMOKE: return "Smoke";
+            default: return "Fire";
+        }
+    }
+};
+
+#endif // FIRE_ANIMATION_H
@@ -6,48 +6,110 @@
 #include "Animation.h"
 #include "frame_io/IFrameSource.h"
 
+// Plays a clip from an IFrameSource. The canvas rows are contiguous, so it is
+// itself a frame in matrix order: sources decode straight into it, or frames
+// lent in place are copied into it once. Between frame advances the canvas
+// already holds the frame, so nothing is drawn and no rect is reported dirty.
+// With a copy of the clip baked into LED order (ClipBaker), plain playback
+// copies its frames straight into the LEDs instead.
 class FrameAnimation : public Animation {
 private:
     IFrameSource* source;
+    IFrameSource* baked;        // Same clip in LED order, or nullptr
     uint16_t frameCount;
     uint16_t current;
     uint16_t frameDelayMs;
     unsigned long lastMs;
-    CRGB currentFrame[TOTAL_SIZE * TOTAL_SIZE]; // Store current frame data
-public:
-    FrameAnimation(IFrameSource* src, uint16_t delayMs)
-        : source(src), frameCount(0), current(0), frameDelayMs(delayMs), lastMs(0) {
-        memset(currentFrame, 0, sizeof(currentFrame));
+    const char* name;
+    CRGB* canvas;               // Canvas the shown frame was written to
+    int32_t shownFrame;         // -1 = nothing drawn yet
+    bool changed;               // The last renderFrame() drew a frame
+
+    static void copyFrame(IFrameSource* from, uint16_t index, CRGB* out) {
+        const CRGB* frame = from->getFramePointer(index);
+        if (frame) {
+            memcpy(out, frame, TOTAL_SIZE * TOTAL_SIZE * sizeof(CRGB));
+        } else {
+            from->getFrameInto(index, out);
+        }
     }
 
+    void drawFrame(uint16_t index, CRGB* out) {
+        copyFrame(source, index, out);
+        canvas = out;
+        shownFrame = index;
+        changed = true;
+    }
+
+public:
+    FrameAnimation(IFrameSource* src, uint16_t delayMs, const char* animName = "Frames")
+        : source(src), baked(nullptr), frameCount(0), current(0), frameDelayMs(delayMs), lastMs(0),
+          name(animName), canvas(nullptr), shownFrame(-1), changed(false) {}
+
+    // Play this LED-order copy of the clip (same frames) when nothing needs the canvas
+    void setPhysicalSource(IFrameSource* physical) { baked = physical; }
+
     void setup() override {
         frameCount = source ? source->getFrameCount() : 0;
         current = 0;
         lastMs = 0;
+        shownFrame = -1;
     }
 
     void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        changed = false;
         if (!source || frameCount == 0) return;
 
         // Handle frame timing - only advance frame when delay has passed
         if (lastMs == 0 || frameTime - lastMs >= frameDelayMs) {
-            source->getFrameInto(current, currentFrame);
+            drawFrame(current, &buffer[0][0]);
             current = (current + 1) % frameCount;
             lastMs = frameTime;
+        } else if (canvas != &buffer[0][0] && shownFrame >= 0) {
+            // Handed a different canvas: it doesn't hold our frame yet
+            drawFrame(shownFrame, &buffer[0][0]);
         }
+    }
 
-        // Convert stored 1D frame data to 2D buffer (row-major order)
-        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
-            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
-                uint16_t index = y * TOTAL_SIZE + x;
-                buffer[y][x] = currentFrame[index];
-            }
+    bool isPhysical() const override { return baked != nullptr; }
+
+    bool renderPhysical(CRGB* leds, uint32_t frameTime, bool redraw) override {
+        if (!baked || frameCount == 0) return false;
+
+        if (lastMs == 0 || frameTime - lastMs >= frameDelayMs) {
+            copyFrame(baked, current, leds);
+            shownFrame = current;
+            canvas = nullptr;       // The canvas doesn't hold this frame
+            current = (current + 1) % frameCount;
+            lastMs = frameTime;
+            return true;
+        }
+        if (redraw && shownFrame >= 0) {
+            copyFrame(baked, shownFrame, leds);
+            return true;
         }
+        return false;
     }
 
-    const char* getName() const override { return "Frames"; }
-};
+    uint8_t getDirtyRects(DirtyRect* rects, uint8_t maxRects) const override {
+        return changed ? DIRTY_FULL_FRAME : 0;
+    }
 
-#endif // FRAME_ANIMATION_H
+    const char* getName() const override { return name; }
 
+    // Cache hits/misses and read latency of the source plain playback reads
+    bool getSourceStats(FrameSourceStats& out) const {
+        IFrameSource* from = baked ? baked : source;
+        return from && from->getStats(out);
+    }
 
+    int formatStats(char* out, size_t len) const override {
+        FrameSourceStats s;
+        if (!getSourceStats(s)) return 0;
+        return snprintf(out, len, "source: %lu hits, %lu misses, read %lu us (max %lu), fetch %lu us%s",
+                        (unsigned long)s.hits, (unsigned long)s.misses, (unsigned long)s.lastReadUs,
+                        (unsigned long)s.maxReadUs, (unsigned long)s.fetchUs, baked ? " (baked)" : "");
+    }
+};
+
+#endif // FRAME_ANIMATION_H
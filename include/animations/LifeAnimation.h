@@ -0,0 +1,217 @@
+#ifndef LIFE_ANIMATION_H
+#define LIFE_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/Palette.h"
+
+// Board is TOTAL_SIZE x TOTAL_SIZE cells, one bit per cell, rows packed into 32-bit words
+#define LIFE_WORDS ((TOTAL_SIZE + 31) / 32)
+#define LIFE_LAST_MASK (TOTAL_SIZE % 32 ? (1UL << (TOTAL_SIZE % 32)) - 1 : 0xFFFFFFFFUL)
+
+// Cellular automaton on a toroidal bit-packed board (Game of Life and B/S rule variants).
+// A generation is computed a whole word (32 cells) at a time: the eight neighbour
+// bitboards are summed with bit-sliced full adders into a 4-bit count per cell,
+// and the birth/survival rule is applied as a mask over those count bits.
+class LifeAnimation : public Animation {
+private:
+    uint32_t cells[TOTAL_SIZE][LIFE_WORDS];
+    uint32_t next[TOTAL_SIZE][LIFE_WORDS];
+    uint32_t history;          // Population-stable generations, for reseeding
+    uint8_t age[TOTAL_SIZE][TOTAL_SIZE];
+
+    uint16_t birthMask;        // bit n set: dead cell with n neighbours is born
+    uint16_t surviveMask;      // bit n set: live cell with n neighbours survives
+    uint16_t stepMs;
+    uint32_t lastStepMs;
+    uint16_t lastPopulation;
+    Palette palette;
+    char rule[16];
+
+    static inline void fullAdd(uint32_t a, uint32_t b, uint32_t c, uint32_t& sum, uint32_t& carry) {
+        uint32_t t = a ^ b;
+        sum = t ^ c;
+        carry = (a & b) | (c & t);
+    }
+
+    // Row shifted so bit x holds cell x-1 (wrapping around the left edge)
+    static void shiftWest(const uint32_t* in, uint32_t* out) {
+        for (uint8_t w = 0; w < LIFE_WORDS; w++) {
+            uint32_t carry = w > 0 ? in[w - 1] >> 31 : (in[LIFE_WORDS - 1] >> ((TOTAL_SIZE - 1) % 32)) & 1;
+            out[w] = (in[w] << 1) | carry;
+        }
+        out[LIFE_WORDS - 1] &= LIFE_LAST_MASK;
+    }
+
+    // Row shifted so bit x holds cell x+1 (wrapping around the right edge)
+    static void shiftEast(const uint32_t* in, uint32_t* out) {
+        for (uint8_t w = 0; w < LIFE_WORDS; w++) {
+            uint32_t carry = w + 1 < LIFE_WORDS ? in[w + 1] << 31 : 0;
+            out[w] = (in[w] >> 1) | carry;
+        }
+        out[LIFE_WORDS - 1] |= (in[0] & 1) << ((TOTAL_SIZE - 1) % 32);
+    }
+
+    // Bitmask of cells whose 4-bit neighbour count (b3 b2 b1 b0) is in countMask
+    static inline uint32_t matchCounts(uint16_t countMask, uint32_t b0, uint32_t b1, uint32_t b2, uint32_t b3) {
+        uint32_t result = 0;
+        for (uint8_t n = 0; n <= 8; n++) {
+            if (!(countMask & (1 << n))) continue;
+            result |= (n & 1 ? b0 : ~b0) & (n & 2 ? b1 : ~b1) &
+                      (n & 4 ? b2 : ~b2) & (n & 8 ? b3 : ~b3);
+        }
+        return result;
+    }
+
+    // Parse "B3/S23"-style rules into count masks
+    bool parseRule(const char* text) {
+        uint16_t b = 0, s = 0;
+        uint16_t* target = nullptr;
+        for (const char* p = text; *p; p++) {
+            if (*p == 'B' || *p == 'b') target = &b;
+            else if (*p == 'S' || *p == 's') target = &s;
+            else if (*p >= '0' && *p <= '8' && target) *target |= 1 << (*p - '0');
+            else if (*p != '/') return false;
+        }
+        birthMask = b;
+        surviveMask = s;
+        return true;
+    }
+
+public:
+    // rule: birth/survival in B/S notation, e.g. "B3/S23" (Life), "B36/S23" (HighLife)
+    LifeAnimation(const char* ruleText = "B3/S23", uint16_t generationMs = 100)
+        : history(0), birthMask(1 << 3), surviveMask((1 << 2) | (1 << 3)),
+          stepMs(generationMs), lastStepMs(0), lastPopulation(0) {
+        if (!parseRule(ruleText)) {
+            Serial.printf("⚠ Invalid Life rule '%s', using B3/S23\n", ruleText);
+            ruleText = "B3/S23";
+        }
+        strncpy(rule, ruleText, sizeof(rule) - 1);
+        rule[sizeof(rule) - 1] = '\0';
+        // Young cells are blue/green, long-lived ones drift to red
+        palette.fromHsvRange(160, 160, 255, 255);
+        memset(cells, 0, sizeof(cells));
+        memset(age, 0, sizeof(age));
+    }
+
+    // One generation, a word of cells at a time (what the animation runs)
+    void step() {
+        uint32_t rows[3][3][LIFE_WORDS]; // [above/same/below][west/centre/east]
+
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            const uint32_t* src[3] = {
+                cells[(y + TOTAL_SIZE - 1) % TOTAL_SIZE], cells[y], cells[(y + 1) % TOTAL_SIZE]
+            };
+            for (uint8_t r = 0; r < 3; r++) {
+                shiftWest(src[r], rows[r][0]);
+                memcpy(rows[r][1], src[r], sizeof(rows[r][1]));
+                shiftEast(src[r], rows[r][2]);
+            }
+
+            for (uint8_t w = 0; w < LIFE_WORDS; w++) {
+                // Sum the eight neighbour bitboards with bit-sliced adders
+                uint32_t s0, c0, s1, c1, s2, c2;
+                fullAdd(rows[0][0][w], rows[0][1][w], rows[0][2][w], s0, c0);
+                fullAdd(rows[2][0][w], rows[2][1][w], rows[2][2][w], s1, c1);
+                s2 = rows[1][0][w] ^ rows[1][2][w];
+                c2 = rows[1][0][w] & rows[1][2][w];
+
+                uint32_t ones, c3;
+                fullAdd(s0, s1, s2, ones, c3);
+
+                uint32_t t, c4;
+                fullAdd(c0, c1, c2, t, c4);
+                uint32_t twos = t ^ c3;
+                uint32_t c5 = t & c3;
+
+                uint32_t fours = c4 ^ c5;
+                uint32_t eights = c4 & c5;
+
+                uint32_t alive = rows[1][1][w];
+                next[y][w] = (alive & matchCounts(surviveMask, ones, twos, fours, eights)) |
+                             (~alive & matchCounts(birthMask, ones, twos, fours, eights));
+            }
+            next[y][LIFE_WORDS - 1] &= LIFE_LAST_MASK;
+        }
+
+        memcpy(cells, next, sizeof(cells));
+    }
+
+    // The same generation counted cell by cell: the reference step() is
+    // checked and benchmarked against (tools/life_bench.cpp)
+    void stepNaive() {
+        memset(next, 0, sizeof(next));
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                uint8_t n = 0;
+                for (int8_t dy = -1; dy <= 1; dy++) {
+                    for (int8_t dx = -1; dx <= 1; dx++) {
+                        if (dx == 0 && dy == 0) continue;
+                        n += isAlive((x + dx + TOTAL_SIZE) % TOTAL_SIZE, (y + dy + TOTAL_SIZE) % TOTAL_SIZE);
+                    }
+                }
+                uint16_t rule = isAlive(x, y) ? surviveMask : birthMask;
+                if (rule & (1 << n)) next[y][x >> 5] |= 1UL << (x & 31);
+            }
+        }
+        memcpy(cells, next, sizeof(cells));
+    }
+
+    // Random board at 37.5% density
+    void seed() {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t w = 0; w < LIFE_WORDS; w++) {
+                // 37.5% density: r & (s | u) of three random words
+                uint32_t r = ((uint32_t)random16() << 16) | random16();
+                uint32_t s = ((uint32_t)random16() << 16) | random16();
+                uint32_t u = ((uint32_t)random16() << 16) | random16();
+                cells[y][w] = r & (s | u);
+            }
+            cells[y][LIFE_WORDS - 1] &= LIFE_LAST_MASK;
+        }
+        memset(age, 0, sizeof(age));
+        history = 0;
+        lastPopulation = 0;
+    }
+
+    void setup() override {
+        seed();
+        lastStepMs = 0;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        if (lastStepMs == 0 || frameTime - lastStepMs >= stepMs) {
+            lastStepMs = frameTime;
+            step();
+
+            // Age live cells and count population to detect a stalled board
+            uint16_t population = 0;
+            for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+                for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                    bool alive = isAlive(x, y);
+                    age[y][x] = alive ? qadd8(age[y][x], 4) : 0;
+                    population += alive;
+                }
+            }
+            history = population == lastPopulation ? history + 1 : 0;
+            lastPopulation = population;
+            if (population == 0 || history > 50) seed();
+        }
+
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                buffer[y][x] = age[y][x] ? palette.lookup(age[y][x]) : CRGB(CRGB::Black);
+            }
+        }
+    }
+
+    bool isAlive(uint8_t x, uint8_t y) const { return (cells[y][x >> 5] >> (x & 31)) & 1; }
+
+    const char* getRule() const { return rule; }
+
+    const char* getName() const override { return "Life"; }
+};
+
+#endif // LIFE_ANIMATION_H
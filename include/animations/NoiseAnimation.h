@@ -0,0 +1,69 @@
+#ifndef NOISE_ANIMATION_H
+#define NOISE_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/NoiseField.h"
+#include "render/Palette.h"
+
+enum NoiseEffect {
+    NOISE_CLOUDS = 0,
+    NOISE_WATER = 1,
+    NOISE_LAVA = 2
+};
+
+// Palette-mapped animated noise field: drifting clouds, shimmering water, slow lava
+class NoiseAnimation : public Animation {
+private:
+    NoiseEffect effect;
+    NoiseField noise;
+    Palette palette;
+    uint16_t speed;          // Q8.8 time lattice steps per second
+    uint8_t paletteDrift;    // Palette rotation per second (0 = none)
+
+public:
+    explicit NoiseAnimation(NoiseEffect fx) : effect(fx), speed(256), paletteDrift(0) {
+        switch (effect) {
+            case NOISE_CLOUDS: {
+                static const GradientStop sky[] = {
+                    {0, 10, 40, 140}, {110, 60, 120, 220}, {170, 200, 215, 240}, {255, 255, 255, 255}
+                };
+                palette.fromGradient(sky, 4);
+                noise.configure(16, 3, 11);
+                speed = 64;
+                break;
+            }
+            case NOISE_WATER:
+                palette.fromGradient_P(PaletteGradients::Ocean);
+                noise.configure(8, 2, 23);
+                speed = 256;
+                paletteDrift = 24;
+                break;
+            case NOISE_LAVA:
+                palette.fromGradient_P(PaletteGradients::Lava);
+                noise.configure(16, 2, 37);
+                speed = 128;
+                break;
+        }
+    }
+
+    void setup() override { noise.invalidate(); }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        noise.update((uint32_t)(((uint64_t)frameTime * speed) / 1000));
+        noise.render(buffer, palette, (uint8_t)(((uint64_t)frameTime * paletteDrift) / 1000));
+    }
+
+    const NoiseField& getField() const { return noise; }
+
+    const char* getName() const override {
+        switch (effect) {
+            case NOISE_WATER: return "Water";
+            case NOISE_LAVA: return "Lava Flow";
+            default: return "Clouds";
+        }
+    }
+};
+
+#endif // NOISE_ANIMATION_H
@@ -0,0 +1,111 @@
+#ifndef PARAGRAPH_ANIMATION_H
+#define PARAGRAPH_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/TextBlock.h"
+
+enum ParagraphMode : uint8_t {
+    PARAGRAPH_PAGE,     // Show as many whole lines as fit, then flip to the next page
+    PARAGRAPH_SCROLL    // Scroll the whole paragraph upwards, one pixel per step
+};
+
+#define PARAGRAPH_LINE_SPACING 1
+
+// Multi-line text: the string is word-wrapped to the canvas width once, on
+// construction and setText(); frames only blit the lines in view.
+class ParagraphAnimation : public Animation {
+private:
+    String text;
+    CRGB textColor;
+    CRGB bgColor;
+    ParagraphMode mode;
+    TextAlign align;
+    uint16_t stepMs;        // Page: time per page. Scroll: time per pixel.
+    BitmapFont* font;
+    TextBlock block;
+    uint8_t linesPerPage;
+    uint16_t page;
+    int scrollY;            // Scroll: pixels scrolled since the text entered at the bottom
+    uint32_t lastStepMs;
+
+    void layout() {
+        block.layout(*font, text.c_str(), TOTAL_SIZE, align, PARAGRAPH_LINE_SPACING);
+        if (block.isTruncated()) {
+            Serial.printf("⚠ Out of memory laying out paragraph text (%u bytes); showing %u lines\n",
+                          text.length(), block.getLineCount());
+        }
+        linesPerPage = (TOTAL_SIZE + PARAGRAPH_LINE_SPACING) / block.getLineHeight();
+        if (linesPerPage == 0) linesPerPage = 1;
+        page = 0;
+        scrollY = 0;
+    }
+
+    uint16_t getPageCount() const {
+        return (block.getLineCount() + linesPerPage - 1) / linesPerPage;
+    }
+
+public:
+    ParagraphAnimation(const char* displayText, ParagraphMode paragraphMode = PARAGRAPH_PAGE,
+                       TextAlign textAlign = ALIGN_CENTER, CRGB color = CRGB::White,
+                       CRGB background = CRGB::Black, uint16_t step = 0)
+        : text(displayText), textColor(color), bgColor(background), mode(paragraphMode),
+          align(textAlign), stepMs(step ? step : (paragraphMode == PARAGRAPH_PAGE ? 2500 : 60)),
+          font(&BitmapFont::builtin()), linesPerPage(1), page(0), scrollY(0), lastStepMs(0) {
+        layout();
+    }
+
+    void setup() override {
+        page = 0;
+        scrollY = 0;
+        lastStepMs = 0;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        if (lastStepMs == 0) lastStepMs = frameTime;
+        bool step = frameTime - lastStepMs >= stepMs;
+        if (step) lastStepMs = frameTime;
+
+        if (mode == PARAGRAPH_PAGE) {
+            uint16_t pages = getPageCount();
+            if (step && pages > 1) page = (page + 1) % pages;
+
+            // Center the page's lines vertically
+            uint16_t first = page * linesPerPage;
+            uint16_t count = block.getLineCount() - first < linesPerPage ? block.getLineCount() - first : linesPerPage;
+            int height = count ? count * block.getLineHeight() - PARAGRAPH_LINE_SPACING : 0;
+            block.render(buffer, (TOTAL_SIZE - height) / 2, textColor, bgColor, first, count);
+        } else {
+            if (step) scrollY++;
+            // Enter from below the canvas, restart once the last line has left the top
+            if (scrollY > TOTAL_SIZE + block.getHeight()) scrollY = 0;
+            block.render(buffer, TOTAL_SIZE - scrollY, textColor, bgColor);
+        }
+    }
+
+    const char* getName() const override {
+        return mode == PARAGRAPH_PAGE ? "Paragraph" : "Paragraph Scroll";
+    }
+
+    void setText(const char* newText) {
+        text = newText;
+        layout();
+    }
+
+    // Render in a loaded font (nullptr = the built-in 5x7 font)
+    void setFont(BitmapFont* newFont) {
+        font = newFont && newFont->isValid() ? newFont : &BitmapFont::builtin();
+        layout();
+    }
+
+    void setAlign(TextAlign newAlign) {
+        align = newAlign;
+        layout();
+    }
+
+    void setColor(CRGB color) { textColor = color; }
+    void setBackground(CRGB color) { bgColor = color; }
+};
+
+#endif // PARAGRAPH_ANIMATION_H
@@ -0,0 +1,214 @@
+#ifndef PARTICLE_ANIMATION_H
+#define PARTICLE_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/Palette.h"
+
+#define PARTICLE_CAPACITY 2048
+#define PARTICLE_SCREEN_MAX ((int16_t)(TOTAL_SIZE << 8))
+
+enum ParticleEffect {
+    PARTICLES_FIREWORKS = 0,
+    PARTICLES_SNOW = 1,
+    PARTICLES_SPARKS = 2
+};
+
+// Particle engine for fireworks, snow and sparks.
+// Particles live in a fixed-capacity structure-of-arrays pool with Q8.8
+// positions/velocities; live particles are kept packed in [0, count) so
+// update and render are straight passes over each array. Nothing is
+// allocated after construction.
+class ParticleAnimation : public Animation {
+private:
+    ParticleEffect effect;
+
+    // Structure-of-arrays pool
+    int16_t posX[PARTICLE_CAPACITY];
+    int16_t posY[PARTICLE_CAPACITY];
+    int16_t velX[PARTICLE_CAPACITY];
+    int16_t velY[PARTICLE_CAPACITY];
+    uint8_t life[PARTICLE_CAPACITY];
+    uint8_t hue[PARTICLE_CAPACITY];
+    uint16_t count;
+
+    // Per-effect physics
+    int16_t gravity;       // Q8.8 pixels per frame^2
+    uint8_t decay;         // life lost per frame
+    uint8_t fade;          // trail fade applied to the previous frame
+
+    Palette palette;
+    uint32_t lastBurstMs;
+    uint32_t updateUs;      // Spawn + integrate + cull time of the last frame
+
+    // Spawn up to n particles at (x, y) with velocity (vx, vy) +/- spread; returns the number spawned
+    uint16_t spawn(uint16_t n, int16_t x, int16_t y, int16_t vx, int16_t vy, int16_t spread, uint8_t baseHue) {
+        if (n > PARTICLE_CAPACITY - count) n = PARTICLE_CAPACITY - count;
+        for (uint16_t i = count; i < count + n; i++) {
+            posX[i] = x;
+            posY[i] = y;
+            velX[i] = vx + (int16_t)random16(2 * spread + 1) - spread;
+            velY[i] = vy + (int16_t)random16(2 * spread + 1) - spread;
+            life[i] = 255 - random8(64);
+            hue[i] = baseHue + random8(16);
+        }
+        count += n;
+        return n;
+    }
+
+    // Radial burst: velocity from a random angle and speed
+    void spawnBurst(uint16_t n, int16_t x, int16_t y, uint8_t speed, uint8_t baseHue) {
+        if (n > PARTICLE_CAPACITY - count) n = PARTICLE_CAPACITY - count;
+        for (uint16_t i = count; i < count + n; i++) {
+            uint8_t angle = random8();
+            uint8_t s = random8(speed / 4, speed);
+            posX[i] = x;
+            posY[i] = y;
+            velX[i] = ((int16_t)cos8(angle) - 128) * s / 128;
+            velY[i] = ((int16_t)sin8(angle) - 128) * s / 128;
+            life[i] = 255 - random8(48);
+            hue[i] = baseHue + random8(24);
+        }
+        count += n;
+    }
+
+    // Batched update; dead or off-screen particles are replaced by the last live one
+    void update() {
+        uint16_t i = 0;
+        while (i < count) {
+            velY[i] += gravity;
+            posX[i] += velX[i];
+            posY[i] += velY[i];
+
+            bool dead = life[i] <= decay ||
+                        posX[i] < -256 || posX[i] >= PARTICLE_SCREEN_MAX ||
+                        posY[i] < -(4 << 8) || posY[i] >= PARTICLE_SCREEN_MAX;
+            if (dead) {
+                count--;
+                posX[i] = posX[count];
+                posY[i] = posY[count];
+                velX[i] = velX[count];
+                velY[i] = velY[count];
+                life[i] = life[count];
+                hue[i] = hue[count];
+                continue;
+            }
+            life[i] -= decay;
+            i++;
+        }
+    }
+
+    void emit(uint32_t frameTime) {
+        switch (effect) {
+            case PARTICLES_FIREWORKS:
+                if (frameTime - lastBurstMs >= 700) {
+                    lastBurstMs = frameTime;
+                    int16_t x = (int16_t)random8(6, TOTAL_SIZE - 6) << 8;
+                    int16_t y = (int16_t)random8(4, TOTAL_SIZE / 2) << 8;
+                    spawnBurst(400, x, y, 160, random8());
+                }
+                break;
+            case PARTICLES_SNOW:
+                for (uint8_t i = 0; i < 3; i++) {
+                    spawn(1, (int16_t)random16(TOTAL_SIZE << 8), -(2 << 8), 0, 40, 16, 0);
+                }
+                break;
+            case PARTICLES_SPARKS:
+                spawn(24, (TOTAL_SIZE / 2) << 8, (TOTAL_SIZE - 1) << 8, 0, -300, 96, 16);
+                break;
+        }
+    }
+
+    // Additive bilinear splat of every live particle into the buffer
+    void splat(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE]) {
+        for (uint16_t i = 0; i < count; i++) {
+            int16_t px = posX[i] >> 8;
+            int16_t py = posY[i] >> 8;
+            uint8_t fx = posX[i] & 0xFF;
+            uint8_t fy = posY[i] & 0xFF;
+
+            CRGB c = palette.lookup(hue[i]);
+            c.nscale8(life[i]);
+
+            uint8_t w[4] = {
+                scale8(255 - fx, 255 - fy), scale8(fx, 255 - fy),
+                scale8(255 - fx, fy),       scale8(fx, fy)
+            };
+            for (uint8_t k = 0; k < 4; k++) {
+                int16_t x = px + (k & 1);
+                int16_t y = py + (k >> 1);
+                if (x < 0 || x >= TOTAL_SIZE || y < 0 || y >= TOTAL_SIZE) continue;
+                CRGB& dst = buffer[y][x];
+                dst.r = qadd8(dst.r, scale8(c.r, w[k]));
+                dst.g = qadd8(dst.g, scale8(c.g, w[k]));
+                dst.b = qadd8(dst.b, scale8(c.b, w[k]));
+            }
+        }
+    }
+
+public:
+    explicit ParticleAnimation(ParticleEffect fx)
+        : effect(fx), count(0), gravity(0), decay(0), fade(255), lastBurstMs(0), updateUs(0) {
+        switch (effect) {
+            case PARTICLES_FIREWORKS:
+                gravity = 3;
+                decay = 4;
+                fade = 96;
+                palette.fromHsvRange(0, 256, 220, 255);
+                break;
+            case PARTICLES_SNOW:
+                gravity = 0;
+                decay = 0;
+                fade = 255;
+                palette.fillSolid(CRGB(200, 220, 255));
+                break;
+            case PARTICLES_SPARKS:
+                gravity = 12;
+                decay = 6;
+                fade = 128;
+                palette.fromGradient_P(PaletteGradients::Heat);
+                break;
+        }
+    }
+
+    void setup() override {
+        count = 0;
+        lastBurstMs = 0;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        uint32_t start = micros();
+        update();
+        emit(frameTime);
+        updateUs = micros() - start;
+
+        // Fade the previous frame for trails, then splat on top
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                buffer[y][x].nscale8(255 - fade);
+            }
+        }
+        splat(buffer);
+    }
+
+    uint16_t getParticleCount() const { return count; }
+
+    // Update throughput of the last frame (spawn + integrate + cull)
+    uint32_t getParticlesPerMs() const { return updateUs ? (uint32_t)count * 1000 / updateUs : 0; }
+
+    int formatStats(char* out, size_t len) const override {
+        return snprintf(out, len, "%u particles, update %lu us (%lu particles/ms)", count,
+                        (unsigned long)updateUs, (unsigned long)getParticlesPerMs());
+    }
+
+    const char* getName() const override {
+        switch (effect) {
+            case PARTICLES_SNOW: return "Snow";
+            case PARTICLES_SPARKS: return "Sparks";
+            default: return "Fireworks";
+        }
+    }
+};
+
+#endif // PARTICLE_ANIMATION_H
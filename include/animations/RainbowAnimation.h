@@ -4,33 +4,51 @@
 #include <Arduino.h>
 #include <FastLED.h>
 #include "Animation.h"
+#include "render/Palette.h"
 
 class RainbowAnimation : public Animation {
 private:
     uint8_t hueOffset;
     uint8_t timeOffset;
+    Palette palette; // hue -> RGB, built once instead of converting HSV per pixel
 public:
-    RainbowAnimation() : hueOffset(0), timeOffset(0) {}
+    RainbowAnimation() : hueOffset(0), timeOffset(0) {
+        palette.fromHsvRange(0, 256, 255, 255);
+    }
     void setup() override {
         hueOffset = 0;
         timeOffset = 0;
     }
     void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        renderBand(buffer, frameTime, 0, TOTAL_SIZE);
+    }
+
+    // Each pixel depends only on (x, y, frameTime), so bands can render in parallel
+    bool isBandParallelSafe() const override { return true; }
+
+    void renderBand(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t yStart, uint8_t yEnd) override {
         // Smooth animated rainbow
         unsigned long time = frameTime / 20; // Faster animation (was /50)
 
-        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
-            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
-                // Create smooth flowing rainbow
-                uint8_t hue = (x * 4 + y * 2 + time) & 0xFF;
+        for (uint8_t y = yStart; y < yEnd; y++) {
+            // Create smooth flowing rainbow: hue = x * 4 + y * 2 + time, stepped per row
+            uint8_t rowHue = (y * 2 + time) & 0xFF;
+            palette.fillRow(buffer[y], TOTAL_SIZE, rowHue << 8, 4 << 8);
+        }
+    }
 
-                // Simple brightness - no complex calculations that could cause black bars
-                uint8_t brightness = 255;
+    // Smooth enough to render at reduced resolution: step the hue by the scale factor
+    bool renderScaled(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t width, uint8_t height) override {
+        uint8_t scale = TOTAL_SIZE / width;
+        unsigned long time = frameTime / 20;
 
-                buffer[y][x] = CHSV(hue, 255, brightness);
-            }
+        for (uint8_t y = 0; y < height; y++) {
+            uint8_t rowHue = (y * 2 * scale + time) & 0xFF;
+            palette.fillRow(buffer[y], width, rowHue << 8, (4 * scale) << 8);
         }
+        return true;
     }
+
     const char* getName() const override { return "Rainbow"; }
 };
 
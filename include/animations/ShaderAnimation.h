@@ -0,0 +1,50 @@
+#ifndef SHADER_ANIMATION_H
+#define SHADER_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/PixelShader.h"
+
+// User-defined palette effect: a compiled pixel-shader program (.psb) loaded from LittleFS
+class ShaderAnimation : public Animation {
+private:
+    String name;
+    PixelShader shader;
+
+public:
+    ShaderAnimation(const char* programPath, const char* displayName) : name(displayName) {
+        shader.load(programPath);
+    }
+
+    bool isValid() const { return shader.isValid(); }
+
+    void setup() override {}
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        shader.renderRows(buffer, frameTime, 0, TOTAL_SIZE, TOTAL_SIZE, 1);
+    }
+
+    // The VM keeps its registers on the caller's stack, so bands can render in parallel
+    bool isBandParallelSafe() const override { return true; }
+
+    void renderBand(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t yStart, uint8_t yEnd) override {
+        shader.renderRows(buffer, frameTime, yStart, yEnd, TOTAL_SIZE, 1);
+    }
+
+    bool renderScaled(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t width, uint8_t height) override {
+        shader.renderRows(buffer, frameTime, 0, height, width, TOTAL_SIZE / width);
+        return true;
+    }
+
+    // Declared in the program with a "symmetry" statement
+    RenderSymmetry getSymmetry() const override { return shader.getSymmetry(); }
+
+    void renderSymmetric(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t width, uint8_t height) override {
+        shader.renderRows(buffer, frameTime, 0, height, width, 1, shader.getSymmetry() == SYMMETRY_8FOLD);
+    }
+
+    const char* getName() const override { return name.c_str(); }
+};
+
+#endif // SHADER_ANIMATION_H
@@ -12,7 +12,11 @@ public:
     explicit SolidColorAnimation(CRGB c) : color(c) {}
     void setup() override {}
     void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
-        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        renderBand(buffer, frameTime, 0, TOTAL_SIZE);
+    }
+    bool isBandParallelSafe() const override { return true; }
+    void renderBand(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime, uint8_t yStart, uint8_t yEnd) override {
+        for (uint8_t y = yStart; y < yEnd; y++) {
             for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
                 buffer[y][x] = color;
             }
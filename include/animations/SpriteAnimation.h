@@ -0,0 +1,83 @@
+#ifndef SPRITE_ANIMATION_H
+#define SPRITE_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <LittleFS.h>
+#include "Animation.h"
+#include "render/SpriteSheet.h"
+#include "render/SpriteLayer.h"
+#include "render/BuiltinSprites.h"
+
+// Bouncing sprites over a static gradient background. Uses the sheet at
+// 'path' on LittleFS when present, otherwise the built-in invader sheet.
+class SpriteAnimation : public Animation {
+private:
+    SpriteSheet sheet;
+    SpriteLayer layer;
+    uint8_t spriteCount;
+    int16_t posX[SPRITE_LAYER_CAPACITY];   // Q8.8
+    int16_t posY[SPRITE_LAYER_CAPACITY];
+    int8_t velX[SPRITE_LAYER_CAPACITY];    // Q8.8 pixels per frame
+    int8_t velY[SPRITE_LAYER_CAPACITY];
+    uint32_t lastFrameStepMs;
+    uint16_t frameStepMs;
+
+public:
+    SpriteAnimation(uint8_t count = 24, const char* path = "/sprites/sprites.spr", uint16_t frameMs = 250)
+        : spriteCount(min(count, (uint8_t)SPRITE_LAYER_CAPACITY)), lastFrameStepMs(0), frameStepMs(frameMs) {
+        if (!path || !LittleFS.exists(path) || !sheet.load(path)) {
+            sheet.loadFromMemory(SPRITE_INVADER, SPRITE_INVADER_SIZE);
+        }
+
+        CRGB (*bg)[TOTAL_SIZE] = layer.getBackground();
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            CRGB c(0, y / 4, 8 + y * 2);
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) bg[y][x] = c;
+        }
+    }
+
+    void setup() override {
+        layer.clear();
+        int16_t maxX = (TOTAL_SIZE - sheet.getFrameWidth()) << 8;
+        int16_t maxY = (TOTAL_SIZE - sheet.getFrameHeight()) << 8;
+        for (uint8_t i = 0; i < spriteCount; i++) {
+            posX[i] = maxX > 0 ? random16(maxX) : 0;
+            posY[i] = maxY > 0 ? random16(maxY) : 0;
+            velX[i] = random8(2) ? random8(24, 96) : -(int8_t)random8(24, 96);
+            velY[i] = random8(2) ? random8(24, 96) : -(int8_t)random8(24, 96);
+            layer.add(&sheet, posX[i] >> 8, posY[i] >> 8, i % sheet.getFrameCount());
+        }
+        lastFrameStepMs = 0;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        bool stepFrame = frameTime - lastFrameStepMs >= frameStepMs;
+        if (stepFrame) lastFrameStepMs = frameTime;
+
+        // Bounce off the canvas edges; sprites may overhang by half their size
+        int16_t minX = -(int16_t)(sheet.getFrameWidth() << 7);
+        int16_t minY = -(int16_t)(sheet.getFrameHeight() << 7);
+        int16_t maxX = (TOTAL_SIZE << 8) + minX;
+        int16_t maxY = (TOTAL_SIZE << 8) + minY;
+        for (uint8_t i = 0; i < layer.getCount(); i++) {
+            posX[i] += velX[i];
+            posY[i] += velY[i];
+            if (posX[i] < minX || posX[i] > maxX) { velX[i] = -velX[i]; posX[i] = constrain(posX[i], minX, maxX); }
+            if (posY[i] < minY || posY[i] > maxY) { velY[i] = -velY[i]; posY[i] = constrain(posY[i], minY, maxY); }
+
+            Sprite& s = layer.get(i);
+            s.x = posX[i] >> 8;
+            s.y = posY[i] >> 8;
+            if (stepFrame) s.frame = (s.frame + 1) % sheet.getFrameCount();
+        }
+
+        layer.render(buffer);
+    }
+
+    SpriteLayer& getLayer() { return layer; }
+
+    const char* getName() const override { return "Sprites"; }
+};
+
+#endif // SPRITE_ANIMATION_H
@@ -0,0 +1,85 @@
+#ifndef STOPWATCH_ANIMATION_H
+#define STOPWATCH_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/TextWidget.h"
+
+// Millisecond stopwatch built from TextWidgets: minutes:seconds on top,
+// milliseconds below. After the first frame only the digits that changed are
+// redrawn and remapped, so it can run at the full loop rate.
+class StopwatchAnimation : public Animation {
+private:
+    TextWidget clock;           // "MM:SS"
+    TextWidget millisField;     // ".mmm"
+    CRGB bgColor;
+    uint32_t startMs;
+    bool fullFrame;             // Whole canvas was redrawn this frame
+    DirtyRect dirty[MAX_DIRTY_RECTS];
+    uint8_t dirtyCount;
+
+    void place() {
+        uint8_t gap = 2;
+        int height = clock.getHeight() + gap + millisField.getHeight();
+        int top = (TOTAL_SIZE - height) / 2;
+        clock.setPosition((TOTAL_SIZE - (int)clock.getWidth()) / 2, top);
+        millisField.setPosition((TOTAL_SIZE - (int)millisField.getWidth()) / 2, top + clock.getHeight() + gap);
+    }
+
+public:
+    StopwatchAnimation(CRGB color = CRGB::White, CRGB background = CRGB::Black)
+        : clock(5, 0, ALIGN_RIGHT), millisField(4, 0, ALIGN_RIGHT), bgColor(background),
+          startMs(0), fullFrame(true), dirtyCount(0) {
+        clock.setColors(color, background);
+        millisField.setColors(color, background);
+        place();
+    }
+
+    void setup() override {
+        startMs = millis();
+        fullFrame = true;
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        if (fullFrame) {
+            for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+                for (uint8_t x = 0; x < TOTAL_SIZE; x++) buffer[y][x] = bgColor;
+            }
+            clock.invalidate();
+            millisField.invalidate();
+        }
+
+        uint32_t elapsed = frameTime - startMs;
+        char text[12];
+        snprintf(text, sizeof(text), "%02lu:%02lu", (unsigned long)(elapsed / 60000 % 100),
+                 (unsigned long)(elapsed / 1000 % 60));
+        clock.set(text);
+        snprintf(text, sizeof(text), ".%03lu", (unsigned long)(elapsed % 1000));
+        millisField.set(text);
+
+        dirtyCount = clock.draw(buffer, dirty, 0, MAX_DIRTY_RECTS);
+        dirtyCount = millisField.draw(buffer, dirty, dirtyCount, MAX_DIRTY_RECTS);
+        if (fullFrame) {
+            dirtyCount = DIRTY_FULL_FRAME;
+            fullFrame = false;
+        }
+    }
+
+    uint8_t getDirtyRects(DirtyRect* rects, uint8_t maxRects) const override {
+        if (dirtyCount == DIRTY_FULL_FRAME || dirtyCount > maxRects) return DIRTY_FULL_FRAME;
+        memcpy(rects, dirty, dirtyCount * sizeof(DirtyRect));
+        return dirtyCount;
+    }
+
+    const char* getName() const override { return "Stopwatch"; }
+
+    void setFont(BitmapFont* font) {
+        clock.setFont(font);
+        millisField.setFont(font);
+        place();
+        fullFrame = true;
+    }
+};
+
+#endif // STOPWATCH_ANIMATION_H
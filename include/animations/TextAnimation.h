@@ -5,7 +5,10 @@
 #include <FastLED.h>
 #include "Animation.h"
 #include "TextRenderer.h"
+#include "render/TextStrip.h"
 
+// Static or scrolling text. The string is rasterized into a TextStrip on
+// construction and setText(); frames only copy the visible window.
 class TextAnimation : public Animation {
 private:
     String text;
@@ -17,20 +20,32 @@ private:
     int currentX;
     uint16_t textWidth;
     bool centered;
+    BitmapFont* font;
+    TextStrip strip;
+
+    void layout() {
+        strip.rasterize(*font, text.c_str());
+        textWidth = strip.getWidth();
+        if (!scrolling) {
+            currentX = centered ? (TOTAL_SIZE - (int)textWidth) / 2 : 0;
+        }
+    }
 
 public:
     // Static text (non-scrolling)
     TextAnimation(const char* displayText, CRGB color = CRGB::White, CRGB background = CRGB::Black, int y = 12, bool center = true)
         : text(displayText), textColor(color), bgColor(background), yPosition(y),
-          scrolling(false), scrollSpeed(0), currentX(0), centered(center) {
-        textWidth = TextRenderer::getTextWidth(displayText);
+          scrolling(false), scrollSpeed(0), currentX(0), centered(center),
+          font(&BitmapFont::builtin()) {
+        layout();
     }
 
     // Scrolling text
     TextAnimation(const char* displayText, int speed, CRGB color = CRGB::White, CRGB background = CRGB::Black, int y = 12)
         : text(displayText), textColor(color), bgColor(background), yPosition(y),
-          scrolling(true), scrollSpeed(speed), currentX(TOTAL_SIZE), centered(false) {
-        textWidth = TextRenderer::getTextWidth(displayText);
+          scrolling(true), scrollSpeed(speed), currentX(TOTAL_SIZE), centered(false),
+          font(&BitmapFont::builtin()) {
+        layout();
     }
 
     void setup() override {
@@ -40,17 +55,17 @@ public:
     }
 
     void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
-        // Clear buffer with background color
-        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        // Background above and below the text band; the strip fills the band itself
+        int bandEnd = yPosition + strip.getHeight();
+        for (int y = 0; y < TOTAL_SIZE; y++) {
+            if (y >= yPosition && y < bandEnd) continue;
             for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
                 buffer[y][x] = bgColor;
             }
         }
+        strip.render(buffer, currentX, yPosition, textColor, bgColor);
 
         if (scrolling) {
-            // Draw scrolling text
-            TextRenderer::drawText(buffer, text.c_str(), currentX, yPosition, textColor);
-
             // Update scroll position
             currentX -= scrollSpeed;
 
@@ -58,13 +73,6 @@ public:
             if (currentX < -textWidth) {
                 currentX = TOTAL_SIZE;
             }
-        } else {
-            // Draw static text
-            if (centered) {
-                TextRenderer::drawCenteredText(buffer, text.c_str(), yPosition, textColor);
-            } else {
-                TextRenderer::drawText(buffer, text.c_str(), 0, yPosition, textColor);
-            }
         }
     }
 
@@ -73,10 +81,13 @@ public:
     // Methods to change text dynamically
     void setText(const char* newText) {
         text = newText;
-        textWidth = TextRenderer::getTextWidth(newText);
-        if (!scrolling) {
-            currentX = centered ? (TOTAL_SIZE - textWidth) / 2 : 0;
-        }
+        layout();
+    }
+
+    // Render in a loaded font (nullptr = the built-in 5x7 font)
+    void setFont(BitmapFont* newFont) {
+        font = newFont && newFont->isValid() ? newFont : &BitmapFont::builtin();
+        layout();
     }
 
     void setColor(CRGB color) { textColor = color; }
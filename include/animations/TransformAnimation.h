@@ -0,0 +1,69 @@
+#ifndef TRANSFORM_ANIMATION_H
+#define TRANSFORM_ANIMATION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/AffineTransform.h"
+
+// Spins and zooms another animation through an AffineTransform. The inner
+// animation renders into a private canvas (kept between frames, as it would be
+// by AnimationManager), which is then resampled onto the output.
+class TransformAnimation : public Animation {
+private:
+    Animation* inner;
+    String name;
+    CRGB source[TOTAL_SIZE][TOTAL_SIZE];
+    AffineTransform transform;
+    AffineEdge edge;
+    CRGB background;          // Fill under AFFINE_TRANSPARENT borders
+
+    int16_t degreesPerSec;    // Rotation speed (negative = counter-clockwise)
+    uint16_t zoomMin;         // Q8.8
+    uint16_t zoomMax;         // Q8.8
+    uint16_t zoomPeriodMs;    // 0 = fixed zoom at zoomMin
+    uint32_t startMs;
+
+public:
+    TransformAnimation(Animation* innerAnim, const char* displayName, int16_t spinDegreesPerSec,
+                       uint16_t minZoom = 256, uint16_t maxZoom = 256, uint16_t zoomPeriod = 0,
+                       AffineEdge edgeMode = AFFINE_TRANSPARENT, CRGB bg = CRGB::Black)
+        : inner(innerAnim), name(displayName), edge(edgeMode), background(bg),
+          degreesPerSec(spinDegreesPerSec), zoomMin(minZoom), zoomMax(maxZoom),
+          zoomPeriodMs(zoomPeriod), startMs(0) {
+        memset(source, 0, sizeof(source));
+    }
+
+    void setup() override {
+        if (inner) inner->setup();
+        startMs = millis();
+    }
+
+    void renderFrame(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime) override {
+        if (!inner) return;
+        inner->renderFrame(source, frameTime);
+
+        uint32_t elapsed = frameTime - startMs;
+        // degrees/s -> 65536-per-turn units: elapsed * deg * 65536 / (360 * 1000)
+        uint16_t angle = (uint16_t)(((int64_t)elapsed * degreesPerSec * 65536) / 360000);
+
+        uint16_t zoom = zoomMin;
+        if (zoomPeriodMs > 0 && zoomMax != zoomMin) {
+            uint16_t phase = (uint16_t)(((uint64_t)(elapsed % zoomPeriodMs) << 16) / zoomPeriodMs);
+            uint8_t wave = (sin16(phase) >> 8) + 128;   // 0..255
+            zoom = zoomMin + (((int32_t)zoomMax - zoomMin) * wave) / 255;
+        }
+
+        transform.set(angle, zoom, zoom, 0, 0, 0);
+        if (edge == AFFINE_TRANSPARENT) {
+            for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+                for (uint8_t x = 0; x < TOTAL_SIZE; x++) buffer[y][x] = background;
+            }
+        }
+        transform.apply(source, buffer, edge);
+    }
+
+    const char* getName() const override { return name.c_str(); }
+};
+
+#endif // TRANSFORM_ANIMATION_H
@@ -0,0 +1,99 @@
+#ifndef AUDIO_ANALYZER_H
+#define AUDIO_ANALYZER_H
+
+#include <stdint.h>
+#include <atomic>
+#include "audio/IAudioSource.h"
+#include "audio/FixedFFT.h"
+
+#if !defined(ARDUINO)
+#include <thread>
+#endif
+
+#define AUDIO_BANDS 16
+#define AUDIO_HOP (AUDIO_FFT_SIZE / 2)       // Samples between analyses (50% overlap)
+#define AUDIO_MIN_BEAT_MS 250
+
+// What the render loop sees of the audio: one analysis of the newest window
+struct AudioSnapshot {
+    uint8_t bands[AUDIO_BANDS];   // Log-spaced band levels, 0..255 (auto-gained, smoothed decay)
+    uint8_t level;                // Overall loudness, 0..255
+    bool beat;                    // Onset in the low bands in this block
+    uint32_t beatCount;
+    uint32_t captureUs;           // audioMicros() when the newest sample was read
+    uint32_t sequence;            // Blocks analysed so far (0 = nothing yet)
+};
+
+// Runs capture, windowing, FFT, band binning and beat detection in its own task
+// (FreeRTOS on the device, std::thread on a host build) and publishes each
+// result through a seqlock, so the render loop reads the latest bands without
+// ever blocking on or being blocked by the audio side.
+class AudioAnalyzer {
+private:
+    IAudioSource* source;
+    FixedFFT fft;
+
+    int16_t samples[AUDIO_FFT_SIZE];     // Sliding window, newest at the end
+    int16_t re[AUDIO_FFT_SIZE];
+    int16_t im[AUDIO_FFT_SIZE];
+    uint16_t magnitude[AUDIO_FFT_BINS];
+    uint16_t bandEdge[AUDIO_BANDS + 1];  // First FFT bin of each band
+
+    // Analysis state, touched only by the audio task
+    uint8_t smoothed[AUDIO_BANDS];
+    uint16_t peakLog;                    // Auto-gain reference, Q4 log2
+    uint32_t bassAverage;
+    uint32_t blocksSinceBeat;
+    uint32_t minBeatBlocks;
+    uint32_t beatCount;
+    uint32_t blocks;
+
+    // Seqlock-published result: odd sequence = write in progress
+    AudioSnapshot published;
+    std::atomic<uint32_t> publishSeq;
+
+    volatile uint32_t processUs;
+    volatile uint32_t hopUs;
+    volatile bool stopping;
+    volatile bool running;
+
+#if defined(ARDUINO)
+    TaskHandle_t task;
+    SemaphoreHandle_t doneSem;
+    static void audioTask(void* param);
+#else
+    std::thread thread;
+#endif
+
+    void run();
+    bool fill(int16_t* dst, uint16_t count);
+    void publish(const AudioSnapshot& snap);
+    static uint16_t log2Q4(uint32_t v);
+
+public:
+    explicit AudioAnalyzer(IAudioSource* audioSource);
+    ~AudioAnalyzer();
+
+    // Start the source and the analysis task
+    bool begin();
+    void end();
+    bool isRunning() const { return running; }
+
+    // Block timing and the minimum beat interval for the given rate (begin()
+    // takes it from the source)
+    void setSampleRate(uint32_t rate);
+
+    // Analyse one hop of new samples (what the task does per block); exposed so
+    // offline tools can drive the pipeline without a task
+    void process(const int16_t* hop, uint32_t captureUs, AudioSnapshot& out);
+
+    // Copy of the latest snapshot; never blocks. False until the first block.
+    bool read(AudioSnapshot& out) const;
+
+    // Time spent analysing the last block, and that as a share of the block's
+    // duration (the audio task's CPU load on its core)
+    uint32_t getProcessUs() const { return processUs; }
+    uint8_t getCpuPercent() const { return hopUs ? (uint8_t)((uint64_t)processUs * 100 / hopUs) : 0; }
+};
+
+#endif // AUDIO_ANALYZER_H
@@ -0,0 +1,37 @@
+#ifndef FIXED_FFT_H
+#define FIXED_FFT_H
+
+#include <stdint.h>
+
+#define AUDIO_FFT_LOG2 9
+#define AUDIO_FFT_SIZE (1 << AUDIO_FFT_LOG2)   // 512 samples: 23 ms at 22.05 kHz
+#define AUDIO_FFT_BINS (AUDIO_FFT_SIZE / 2)
+
+// In-place radix-2 decimation-in-time FFT on Q15 samples.
+//
+// Every butterfly stage halves its outputs, so the transform can never
+// overflow 16 bits and the result is the true spectrum scaled by 1/N.
+// Twiddles, the Hann window and the bit-reversal permutation are tables built
+// once in the constructor; the transform itself is integer only.
+class FixedFFT {
+private:
+    int16_t cosTable[AUDIO_FFT_SIZE / 2];
+    int16_t sinTable[AUDIO_FFT_SIZE / 2];
+    int16_t window[AUDIO_FFT_SIZE];
+    uint16_t bitReverse[AUDIO_FFT_SIZE];
+
+public:
+    FixedFFT();
+
+    // Multiply by the Hann window and place the samples in bit-reversed order,
+    // ready for transform(); im is cleared
+    void load(const int16_t* samples, int16_t* re, int16_t* im) const;
+
+    // Butterflies over bit-reversed input from load()
+    void transform(int16_t* re, int16_t* im) const;
+
+    // |X[k]| for k = 0..AUDIO_FFT_BINS-1 (alpha-max-plus-beta-min estimate)
+    static void magnitudes(const int16_t* re, const int16_t* im, uint16_t* mag);
+};
+
+#endif // FIXED_FFT_H
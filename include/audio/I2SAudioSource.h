@@ -0,0 +1,83 @@
+#ifndef I2S_AUDIO_SOURCE_H
+#define I2S_AUDIO_SOURCE_H
+
+#if defined(ARDUINO)
+
+#include <Arduino.h>
+#include <driver/i2s.h>
+#include "audio/IAudioSource.h"
+
+// I2S MEMS microphone (INMP441 / SPH0645 style: 24-bit samples left-aligned in
+// 32-bit slots, left channel). DMA buffers absorb capture while the analyzer
+// works; read() blocks in the driver until a block is ready.
+class I2SAudioSource : public IAudioSource {
+private:
+    uint8_t bckPin;
+    uint8_t wsPin;
+    uint8_t dataPin;
+    uint32_t sampleRate;
+    bool installed;
+    int32_t raw[128];
+
+public:
+    I2SAudioSource(uint8_t bck, uint8_t ws, uint8_t data, uint32_t rate = 22050)
+        : bckPin(bck), wsPin(ws), dataPin(data), sampleRate(rate), installed(false) {}
+
+    ~I2SAudioSource() {
+        if (installed) i2s_driver_uninstall(I2S_NUM_0);
+    }
+
+    bool begin() override {
+        if (installed) return true;
+
+        i2s_config_t config = {};
+        config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
+        config.sample_rate = sampleRate;
+        config.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
+        config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+        config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+        config.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+        config.dma_buf_count = 4;
+        config.dma_buf_len = 256;
+
+        i2s_pin_config_t pins = {};
+        pins.mck_io_num = I2S_PIN_NO_CHANGE;
+        pins.bck_io_num = bckPin;
+        pins.ws_io_num = wsPin;
+        pins.data_out_num = I2S_PIN_NO_CHANGE;
+        pins.data_in_num = dataPin;
+
+        if (i2s_driver_install(I2S_NUM_0, &config, 0, nullptr) != ESP_OK) {
+            Serial.println("✗ I2S driver install failed");
+            return false;
+        }
+        if (i2s_set_pin(I2S_NUM_0, &pins) != ESP_OK) {
+            Serial.println("✗ I2S pin configuration failed");
+            i2s_driver_uninstall(I2S_NUM_0);
+            return false;
+        }
+        installed = true;
+        Serial.printf("✓ I2S microphone: BCK %d, WS %d, SD %d @ %lu Hz\n",
+                      bckPin, wsPin, dataPin, (unsigned long)sampleRate);
+        return true;
+    }
+
+    uint32_t getSampleRate() const override { return sampleRate; }
+
+    size_t read(int16_t* out, size_t count) override {
+        if (!installed) return 0;
+        if (count > sizeof(raw) / sizeof(raw[0])) count = sizeof(raw) / sizeof(raw[0]);
+
+        size_t bytes = 0;
+        if (i2s_read(I2S_NUM_0, raw, count * sizeof(int32_t), &bytes, portMAX_DELAY) != ESP_OK) return 0;
+
+        // Top 16 of the 24 significant bits
+        size_t n = bytes / sizeof(int32_t);
+        for (size_t i = 0; i < n; i++) out[i] = (int16_t)(raw[i] >> 16);
+        return n;
+    }
+};
+
+#endif // ARDUINO
+
+#endif // I2S_AUDIO_SOURCE_H
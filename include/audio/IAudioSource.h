@@ -0,0 +1,46 @@
+#ifndef IAUDIO_SOURCE_H
+#define IAUDIO_SOURCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+// Monotonic microsecond clock shared by the audio pipeline and its sources
+static inline uint32_t audioMicros() {
+#if defined(ARDUINO)
+    return micros();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+static inline void audioSleepMs(uint32_t ms) {
+#if defined(ARDUINO)
+    delay(ms);
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+}
+
+// Mono 16-bit PCM input for the audio analyzer (I2S microphone on the device,
+// WAV files for playback or host-side benchmarking)
+class IAudioSource {
+public:
+    virtual ~IAudioSource() {}
+
+    virtual bool begin() = 0;
+    virtual uint32_t getSampleRate() const = 0;
+
+    // Block until up to count samples are available and copy them into out.
+    // Returns the number of samples read; 0 means the source has ended.
+    virtual size_t read(int16_t* out, size_t count) = 0;
+};
+
+#endif // IAUDIO_SOURCE_H
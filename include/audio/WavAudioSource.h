@@ -0,0 +1,155 @@
+#ifndef WAV_AUDIO_SOURCE_H
+#define WAV_AUDIO_SOURCE_H
+
+#include <string.h>
+#include "audio/IAudioSource.h"
+
+#if defined(ARDUINO)
+#include <LittleFS.h>
+#else
+#include <stdio.h>
+#include <string>
+#endif
+
+// 16-bit PCM WAV file (mono, or stereo mixed down to mono). From LittleFS on the
+// device, from the local filesystem on a host build. In real-time mode reads are
+// paced to the file's sample rate, as a microphone would deliver them.
+class WavAudioSource : public IAudioSource {
+private:
+#if defined(ARDUINO)
+    String path;
+    File file;
+#else
+    std::string path;
+    FILE* file;
+#endif
+    uint32_t sampleRate;
+    uint16_t channels;
+    uint32_t dataStart;
+    uint32_t dataSize;
+    uint32_t dataRead;
+    bool realtime;
+    bool loop;
+    uint32_t startUs;
+    uint64_t samplesDelivered;
+
+    size_t readBytes(void* dst, size_t n) {
+#if defined(ARDUINO)
+        return file.read((uint8_t*)dst, n);
+#else
+        return fread(dst, 1, n, file);
+#endif
+    }
+
+    bool seek(uint32_t pos) {
+#if defined(ARDUINO)
+        return file.seek(pos);
+#else
+        return fseek(file, pos, SEEK_SET) == 0;
+#endif
+    }
+
+    // Walk the RIFF chunks for "fmt " and "data"
+    bool parseHeader() {
+        uint8_t riff[12];
+        if (readBytes(riff, 12) != 12 || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0) return false;
+
+        uint32_t pos = 12;
+        bool haveFormat = false;
+        for (;;) {
+            uint8_t chunk[8];
+            if (readBytes(chunk, 8) != 8) return false;
+            uint32_t size = chunk[4] | (chunk[5] << 8) | (chunk[6] << 16) | ((uint32_t)chunk[7] << 24);
+            pos += 8;
+
+            if (memcmp(chunk, "fmt ", 4) == 0) {
+                uint8_t fmt[16];
+                if (size < 16 || readBytes(fmt, 16) != 16) return false;
+                uint16_t format = fmt[0] | (fmt[1] << 8);
+                channels = fmt[2] | (fmt[3] << 8);
+                sampleRate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+                uint16_t bits = fmt[14] | (fmt[15] << 8);
+                if (format != 1 || bits != 16 || channels < 1 || channels > 2 || sampleRate == 0) return false;
+                haveFormat = true;
+            } else if (memcmp(chunk, "data", 4) == 0) {
+                if (!haveFormat) return false;
+                dataStart = pos;
+                dataSize = size;
+                return true;
+            }
+
+            pos += size + (size & 1);   // chunks are word aligned
+            if (!seek(pos)) return false;
+        }
+    }
+
+public:
+    WavAudioSource(const char* filePath, bool pacedToRealtime = true, bool loopAtEnd = true)
+        : path(filePath),
+#if !defined(ARDUINO)
+          file(nullptr),
+#endif
+          sampleRate(0), channels(0), dataStart(0), dataSize(0), dataRead(0),
+          realtime(pacedToRealtime), loop(loopAtEnd), startUs(0), samplesDelivered(0) {}
+
+    ~WavAudioSource() {
+#if defined(ARDUINO)
+        if (file) file.close();
+#else
+        if (file) fclose(file);
+#endif
+    }
+
+    bool begin() override {
+#if defined(ARDUINO)
+        file = LittleFS.open(path, "r");
+        if (!file) {
+            Serial.printf("✗ WAV file not found: %s\n", path.c_str());
+            return false;
+        }
+#else
+        file = fopen(path.c_str(), "rb");
+        if (!file) return false;
+#endif
+        if (!parseHeader()) {
+#if defined(ARDUINO)
+            Serial.printf("✗ Unsupported WAV file (need 16-bit PCM, mono or stereo): %s\n", path.c_str());
+#endif
+            return false;
+        }
+        dataRead = 0;
+        startUs = audioMicros();
+        samplesDelivered = 0;
+        return true;
+    }
+
+    uint32_t getSampleRate() const override { return sampleRate; }
+
+    size_t read(int16_t* out, size_t count) override {
+        if (!file || dataSize == 0) return 0;
+
+        if (realtime) {
+            // Wait until the last requested sample would have been captured
+            uint64_t dueUs = (samplesDelivered + count) * 1000000ULL / sampleRate;
+            uint32_t elapsed = audioMicros() - startUs;
+            if (dueUs > elapsed) audioSleepMs((uint32_t)((dueUs - elapsed) / 1000));
+        }
+
+        size_t produced = 0;
+        int16_t frame[2];
+        size_t frameBytes = channels * sizeof(int16_t);
+        while (produced < count) {
+            if (dataRead + frameBytes > dataSize) {
+                if (!loop || !seek(dataStart)) break;
+                dataRead = 0;
+            }
+            if (readBytes(frame, frameBytes) != frameBytes) break;
+            dataRead += frameBytes;
+            out[produced++] = channels == 2 ? (int16_t)(((int32_t)frame[0] + frame[1]) >> 1) : frame[0];
+        }
+        samplesDelivered += produced;
+        return produced;
+    }
+};
+
+#endif // WAV_AUDIO_SOURCE_H
@@ -0,0 +1,70 @@
+#ifndef CLIP_BAKER_H
+#define CLIP_BAKER_H
+
+#include <Arduino.h>
+#include "FsFrameSource.h"
+#include "MatrixOrientation.h"
+
+#define CLIP_BAKE_FREE_MARGIN (16 * 1024)   // LittleFS left free after a bake, for metadata and config
+
+// Bakes LFX clips for one wall: every frame is remapped once, through the same
+// MatrixOrientation the render loop uses, and stored in LED order next to the
+// clip ("fire.lfx" -> "fire.baked.lfx"). Playing the baked copy is a single
+// copy into the LED buffer per frame, with no canvas and no remap.
+//
+// The baked copy records the mapping hash of the wall and the size and last
+// write time of the clip it came from; when any of them no longer matches
+// (panel config or clip changed), it is baked again. Baked frames are raw
+// RGB888, so a compressed clip grows several times over: a bake that would
+// not fit the free LittleFS space is skipped. If baking is skipped or fails,
+// the caller plays the clip as it is.
+class ClipBaker {
+private:
+    MatrixOrientation* matrix;
+
+    // Header of a baked clip, read without opening it as a frame source;
+    // false if it isn't a complete baked clip
+    static bool readBakedHeader(const char* bakedPath, LfxHeader& header, LfxPhysicalHeader& physical);
+
+    bool bake(const char* bakedPath, IFrameSource* logical, const LfxPhysicalHeader& physical);
+
+public:
+    ClipBaker(MatrixOrientation* matrixPtr) : matrix(matrixPtr) {}
+
+    static String getBakedPath(const char* clipPath);
+
+    // Baked copy of the clip at clipPath, baked first if missing or stale;
+    // nullptr if it can't be baked. The clip itself is only opened to bake it.
+    FsFrameSource* open(const char* clipPath);
+};
+
+// Matrix-order frames of a baked clip, gathered back through the wall's
+// mapping. Lets the canvas path (transforms, post passes) play from the same
+// FsFrameSource as plain playback, so a baked clip has one file handle,
+// prefetch task and clip cache entry rather than two.
+class BakedCanvasSource : public IFrameSource {
+private:
+    FsFrameSource* baked;
+    uint16_t ledOf[TOTAL_SIZE * TOTAL_SIZE];    // Pixel (y * TOTAL_SIZE + x) -> LED index
+    CRGB leds[TOTAL_LEDS];
+
+public:
+    BakedCanvasSource(FsFrameSource* bakedSource, MatrixOrientation* matrix) : baked(bakedSource) {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                ledOf[y * TOTAL_SIZE + x] = matrix->getLEDIndex(x, y);
+            }
+        }
+    }
+
+    uint16_t getFrameCount() const override { return baked->getFrameCount(); }
+
+    void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) override {
+        baked->getFrameInto(frameIndex, leds);
+        for (uint16_t i = 0; i < TOTAL_SIZE * TOTAL_SIZE; i++) ledsOut[i] = leds[ledOf[i]];
+    }
+
+    bool getStats(FrameSourceStats& out) const override { return baked->getStats(out); }
+};
+
+#endif // CLIP_BAKER_H
@@ -0,0 +1,89 @@
+#ifndef CLIP_CACHE_H
+#define CLIP_CACHE_H
+
+#include <Arduino.h>
+
+#define CLIP_CACHE_MAX_CLIPS 8
+#define CLIP_CACHE_DEFAULT_KB 4096
+
+// Identifies a cached clip; stays valid until that clip is evicted
+struct ClipHandle {
+    int8_t slot;
+    uint32_t serial;
+
+    ClipHandle() : slot(-1), serial(0) {}
+    bool isSet() const { return slot >= 0; }
+};
+
+struct ClipCacheStats {
+    uint32_t budgetBytes;
+    uint32_t usedBytes;     // Reserved for the clips held
+    uint32_t loadedBytes;   // Of that, frames already copied in
+    uint8_t clips;
+    uint32_t hits;          // Frames served from PSRAM
+    uint32_t misses;        // Frames of cacheable clips that weren't loaded yet
+    uint32_t evictions;
+    uint32_t rejected;      // Clips larger than the budget (streamed instead)
+};
+
+// Whole LFX clips in PSRAM, shared by all frame sources, up to a byte budget.
+// A clip gets its buffer when it is first played and fills up as its frames
+// stream in, so the first pass costs no more than plain streaming and later
+// passes are memory copies. When a new clip doesn't fit, the least recently
+// played clips are evicted. Used from the render loop only (not thread-safe).
+class ClipCache {
+private:
+    struct Entry {
+        String path;
+        uint32_t fileSize;      // With fileTime, tells a replaced file from the one cached
+        uint32_t fileTime;
+        uint8_t* data;          // frames * frameBytes, in PSRAM
+        uint8_t* loaded;        // Bit per frame: already copied in
+        uint32_t bytes;
+        uint16_t frames;
+        uint16_t framesLoaded;
+        uint32_t frameBytes;
+        uint32_t lastUse;
+        uint32_t serial;
+    } entries[CLIP_CACHE_MAX_CLIPS];
+
+    uint32_t budget;
+    uint32_t used;
+    uint32_t useClock;
+    uint32_t nextSerial;
+    ClipCacheStats stats;
+
+    ClipCache();
+    Entry* resolve(const ClipHandle& handle);
+    void evict(uint8_t slot);
+
+public:
+    static ClipCache& shared();
+
+    // Byte budget (0 disables the cache); evicts clips until it fits
+    void setBudget(uint32_t bytes);
+    uint32_t getBudget() const { return budget; }
+
+    // Find or create the entry for a clip about to play; an unset handle if
+    // it can't be cached (larger than the budget, or out of PSRAM). fileSize
+    // and fileTime (the file's last write) are part of the key, so a clip
+    // replaced under the same path drops the stale copy instead of serving it
+    ClipHandle open(const char* path, uint32_t fileSize, uint32_t fileTime, uint16_t frames, uint32_t frameBytes);
+
+    // False once the clip has been evicted
+    bool isValid(const ClipHandle& handle) { return resolve(handle) != nullptr; }
+
+    // A frame of a cached clip, or nullptr if it isn't loaded yet (counts a
+    // hit or miss and marks the clip as recently played)
+    const uint8_t* getFrame(const ClipHandle& handle, uint16_t frame);
+
+    // Copy in a frame that was just read from flash
+    void storeFrame(const ClipHandle& handle, uint16_t frame, const uint8_t* src);
+
+    // Evict a clip that won't be played again (e.g. one only read to bake it)
+    void drop(const char* path);
+
+    const ClipCacheStats& getStats();
+};
+
+#endif // CLIP_CACHE_H
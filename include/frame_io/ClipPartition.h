@@ -0,0 +1,61 @@
+#ifndef CLIP_PARTITION_H
+#define CLIP_PARTITION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Clip partition image (tools/lfx_pack.py): a directory, then the LFX files
+// it lists, each starting on a 16-byte boundary. Offsets are from the start
+// of the image.
+struct ClipPackHeader {
+    char magic[4];          // "LFXP"
+    uint16_t version;       // 1
+    uint16_t count;         // Directory entries that follow
+} __attribute__((packed));
+
+struct ClipPackEntry {
+    char name[24];          // NUL-terminated
+    uint32_t offset;
+    uint32_t size;
+    uint16_t frameMs;       // Playback delay per frame
+    uint16_t reserved;
+} __attribute__((packed));
+
+#define CLIP_PARTITION_LABEL "clips"
+#define CLIP_PARTITION_SUBTYPE 0x40
+
+// Read-only view of a clip partition. On the device the raw flash partition
+// is mapped into the data address space, on a host build an image file is
+// mmap()ed, so clips can be played straight from the mapping without copies.
+class ClipPartition {
+private:
+    const uint8_t* base;
+    size_t size;
+    const ClipPackEntry* entries;
+    uint16_t count;
+#if defined(ARDUINO)
+    uint32_t mapHandle;
+#else
+    int fd;
+#endif
+
+    bool parse();
+
+public:
+    ClipPartition();
+    ~ClipPartition();
+
+    // Device: partition label; host: path of the image file
+    bool begin(const char* source = CLIP_PARTITION_LABEL);
+    void end();
+
+    bool isMapped() const { return base != nullptr; }
+    uint16_t getCount() const { return count; }
+    const ClipPackEntry& getEntry(uint16_t index) const { return entries[index]; }
+    const uint8_t* getClip(uint16_t index) const { return base + entries[index].offset; }
+
+    // Index of a clip by name, -1 if absent
+    int16_t find(const char* name) const;
+};
+
+#endif // CLIP_PARTITION_H
@@ -5,59 +5,120 @@
 #include <FastLED.h>
 #include <LittleFS.h>
 #include "IFrameSource.h"
+#include "ClipCache.h"
+#include "LfxDecoder.h"
 
-struct LfxHeader {
-    char magic[4];      // "LFX1"
-    uint16_t width;     // 32
-    uint16_t height;    // 32
-    uint16_t frames;    // number of frames
-    uint8_t format;     // 0 = RGB888
-} __attribute__((packed));
+#if !defined(ARDUINO)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
+#define FS_PREFETCH_FRAMES 4    // Frames read ahead of playback
+
+// LFX clip streamed from LittleFS. The file stays open for the life of the
+// source, and a background task (FreeRTOS on the device, std::thread in the
+// host build of tools/fs_bench.cpp) reads the next frames in playback order, wrapping at the end,
+// into a small ring. getFrameInto() then copies from RAM; it only reads flash
+// itself when the requested frame isn't there yet (a miss: the first frame,
+// a seek, or playback outrunning the flash).
+//
+// Compressed (LFX2) clips go through an LfxDecoder; the prefetch task then
+// decodes ahead as well as reading, and the ring holds decoded frames.
+// Palette-indexed clips read a third (or a sixth) of the bytes and are
+// expanded with a table lookup.
+//
+// Clips that fit the shared ClipCache budget are also copied into PSRAM as
+// they play; once a frame is there, it is served without touching flash.
 class FsFrameSource : public IFrameSource {
 private:
     String path;
     LfxHeader header;
     bool valid;
+    File file;
+    size_t frameBytes;          // Decoded size of one frame
+    uint32_t dataStart;         // Fixed-size frames: file offset of frame 0
+    uint32_t frameStride;       // and bytes per frame in the file
+    uint32_t fileSize;          // Identify this version of the file to the clip cache
+    uint32_t fileTime;          // Last write (0 without LittleFS timestamps)
+
+    // Indexed clips
+    uint8_t indexBits;          // 8 or 4, 0 = not indexed
+    bool framePalettes;         // Each frame carries its own palette
+    uint16_t paletteBytes;
+    uint8_t* palette;           // 256 entries, r g b; owned
+
+    // Compressed clips: the decoder reads through the open file
+    class FileReader : public LfxReader {
+    public:
+        File* file;
+        size_t readAt(uint32_t offset, uint8_t* dst, size_t len) override {
+            return file->seek(offset, SeekSet) ? file->read(dst, len) : 0;
+        }
+    } fileReader;
+    LfxDecoder* decoder;        // nullptr for raw clips
+
+    struct Slot {
+        int32_t frame;          // -1 = empty
+        bool ready;             // false while the task is filling it
+        uint8_t* data;
+    };
+    Slot slots[FS_PREFETCH_FRAMES];
+    uint8_t depth;              // Slots in use (0 = no prefetch task)
+    uint8_t* ring;              // depth * frameBytes, owned
+    uint16_t nextWanted;        // Frame playback needs next; the window starts here
+
+    ClipHandle clip;            // Entry in the PSRAM clip cache
+    bool cacheRejected;         // Clip doesn't fit the cache: always stream
+
+    volatile bool stopping;
+    volatile bool running;
+    FrameSourceStats stats;
+
+#if defined(ARDUINO)
+    TaskHandle_t task;
+    SemaphoreHandle_t slotLock;
+    SemaphoreHandle_t fileLock;
+    SemaphoreHandle_t doneSem;
+    static void prefetchTask(void* param);
+#else
+    std::thread thread;
+    mutable std::mutex slotLock;
+    std::mutex fileLock;
+    std::condition_variable wakeCv;
+    bool wakePending;
+#endif
+
+    void lockSlots() const;
+    void unlockSlots() const;
+    void lockFile();
+    void unlockFile();
+    void wakeTask();
+    void waitForWork();
+
+    bool readFrame(uint16_t frameIndex, uint8_t* dst);
+    bool openIndexed();
+    bool startPrefetch(uint8_t frames);
+    void stopPrefetch();
+    void prefetchLoop();
+    bool inWindow(uint16_t frame) const;
+    Slot* findSlot(uint16_t frame);
 
 public:
-    explicit FsFrameSource(const char* filePath) : path(filePath), valid(false) {
-        memset(&header, 0, sizeof(header));
-        if (!LittleFS.begin()) return;
-        if (!LittleFS.exists(path)) return;
-        File f = LittleFS.open(path, "r");
-        if (!f) return;
-        if (f.readBytes((char*)&header, sizeof(header)) != sizeof(header)) { f.close(); return; }
-        if (strncmp(header.magic, "LFX1", 4) != 0) { f.close(); return; }
-        if (header.width != 32 || header.height != 32) { f.close(); return; }
-        if (header.format != 0) { f.close(); return; }
-        valid = true;
-        f.close();
-    }
+    // prefetchFrames = 0 reads synchronously (still through the open handle)
+    explicit FsFrameSource(const char* filePath, uint8_t prefetchFrames = FS_PREFETCH_FRAMES);
+    ~FsFrameSource();
 
     bool isValid() const { return valid; }
 
+    // Frames are in LED order for the wall with this mapping hash
+    bool isPhysical() const { return valid && header.format == LFX_FORMAT_RGB888_PHYSICAL; }
+
     uint16_t getFrameCount() const override { return valid ? header.frames : 0; }
 
-    void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) override {
-        if (!valid) return;
-        File f = LittleFS.open(path, "r");
-        if (!f) return;
-        size_t frameSize = 32 * 32 * 3;
-        size_t offset = sizeof(LfxHeader) + (size_t)frameIndex % header.frames * frameSize;
-        f.seek(offset, SeekSet);
-        // Read raw RGB888 and convert to CRGB
-        static uint8_t buf[1024 * 3];
-        size_t n = f.read(buf, frameSize);
-        f.close();
-        if (n == frameSize) {
-            for (int i = 0; i < 1024; i++) {
-                ledsOut[i] = CRGB(buf[i*3 + 0], buf[i*3 + 1], buf[i*3 + 2]);
-            }
-        }
-    }
+    void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) override;
+
+    bool getStats(FrameSourceStats& out) const override;
 };
 
 #endif // FS_FRAME_SOURCE_H
-
-
@@ -4,11 +4,30 @@
 #include <Arduino.h>
 #include <FastLED.h>
 
+// Read statistics of a frame source
+struct FrameSourceStats {
+    uint32_t hits;          // Frames served from a read-ahead cache
+    uint32_t misses;        // Frames that had to be read on the render path
+    uint32_t lastReadUs;    // Time the latest getFrameInto() took
+    uint32_t maxReadUs;
+    uint32_t fetchUs;       // Storage read time of the latest frame fetched in the background
+};
+
 class IFrameSource {
 public:
     virtual ~IFrameSource() {}
     virtual uint16_t getFrameCount() const = 0;
-    virtual void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) = 0; // fills 32x32 into ledsOut in matrix order
+    // Fills 32x32 into ledsOut in matrix order. ledsOut is usually the
+    // animation's canvas itself, so sources write (or decode) straight into it.
+    virtual void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) = 0;
+
+    // Frame in place (matrix order) for sources whose frames sit decoded in
+    // addressable memory, valid while the source lives; nullptr if the frame
+    // has to be copied out with getFrameInto()
+    virtual const CRGB* getFramePointer(uint16_t frameIndex) { return nullptr; }
+
+    // Sources that cache or stream report their hit rate and read latency
+    virtual bool getStats(FrameSourceStats& out) const { return false; }
 };
 
 #endif // IFRAME_SOURCE_H
@@ -0,0 +1,81 @@
+#ifndef LFX_DECODER_H
+#define LFX_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "LfxFormat.h"
+
+#define LFX_PIXELS (32 * 32)
+#define LFX_FRAME_BYTES (LFX_PIXELS * 3)
+#define LFX_DECODE_CHUNK 256    // Compressed bytes read per call
+
+// Expand palette indices (1024 bytes, or 512 for 4 bits) to r g b. They may
+// sit at the end of the frame buffer itself: each pixel is written only
+// after the indices it overlaps have been read.
+void lfxExpandIndexed(uint8_t* frame, const uint8_t* indices, const uint8_t* palette, uint8_t bits);
+
+// Where the decoder gets compressed bytes from (a LittleFS file on the
+// device, a stdio file in the host tools)
+class LfxReader {
+public:
+    virtual ~LfxReader() {}
+    virtual size_t readAt(uint32_t offset, uint8_t* dst, size_t len) = 0;
+};
+
+// Clip already in the address space (mapped flash, or RAM)
+class LfxMemoryReader : public LfxReader {
+public:
+    const uint8_t* data;
+    uint32_t size;
+
+    LfxMemoryReader(const uint8_t* clip = nullptr, uint32_t clipSize = 0) : data(clip), size(clipSize) {}
+    size_t readAt(uint32_t offset, uint8_t* dst, size_t len) override {
+        if (offset >= size) return 0;
+        if (len > size - offset) len = size - offset;
+        memcpy(dst, data + offset, len);
+        return len;
+    }
+};
+
+// Streaming decoder for LFX2 clips. Runs are applied straight to the
+// decoder's reference frame as small chunks are read, so the working set is
+// one frame plus one chunk, whatever the clip length. Playing forward decodes
+// one frame per call; a seek restarts from the nearest keyframe before it.
+class LfxDecoder {
+private:
+    uint32_t* offsets;          // frames + 1 entries, owned
+    uint16_t frames;
+    int32_t decoded;            // Frame held in 'frame', -1 = none
+    uint8_t frame[LFX_FRAME_BYTES];
+    uint8_t chunk[LFX_DECODE_CHUNK];
+
+    // Run state, carried across chunk boundaries
+    uint16_t pos;               // Next pixel
+    uint8_t count;              // Pixels left in the current run, 0 = control byte next
+    bool literal;
+    uint8_t partial;            // Bytes of 'pixel' read so far
+    uint8_t pixel[3];
+
+    void applyRuns(const uint8_t* in, size_t len);
+    bool applyFrame(LfxReader& reader, uint16_t index);
+
+public:
+    LfxDecoder();
+    ~LfxDecoder();
+
+    // Read the offset table that follows the header; false if it is
+    // malformed (not ascending, or past fileSize)
+    bool begin(LfxReader& reader, uint16_t frameCount, uint32_t fileSize);
+    void end();
+
+    // Decode a frame into dst (LFX_FRAME_BYTES); false on a read error
+    bool decode(LfxReader& reader, uint16_t index, uint8_t* dst);
+
+    bool isKeyframe(uint16_t index) const { return index == 0 || (offsets[index] & LFX_KEYFRAME); }
+    uint32_t getFrameSize(uint16_t index) const {
+        return (offsets[index + 1] & ~LFX_KEYFRAME) - (offsets[index] & ~LFX_KEYFRAME);
+    }
+};
+
+#endif // LFX_DECODER_H
@@ -0,0 +1,62 @@
+#ifndef LFX_FORMAT_H
+#define LFX_FORMAT_H
+
+#include <stdint.h>
+
+// LFX clip files: 32x32 frames, pixels in row-major order, r g b per pixel.
+//
+// "LFX1" clips have fixed-size frames:
+//   LFX_FORMAT_RGB888: the header, then frames * 3072 bytes of raw pixels.
+//   LFX_FORMAT_INDEXED8 / LFX_FORMAT_INDEXED4: the header, an LfxPaletteHeader,
+//   then the palette (colors * 3 bytes, r g b) and frames * 1024 (or 512)
+//   bytes of palette indices; 4-bit frames pack two pixels per byte, the
+//   first in the high nibble. With LFX_PALETTE_PER_FRAME, every frame starts
+//   with its own palette instead.
+//   LFX_FORMAT_RGB888_PHYSICAL: the header, an LfxPhysicalHeader, then
+//   frames * 3072 bytes of pixels in LED order rather than row-major order:
+//   a clip baked for one wall (ClipBaker), played without the remap.
+//
+// "LFX2", LFX_FORMAT_DELTA_RLE: the header, then frames + 1 little-endian
+// uint32 file offsets; frame i is the bytes from entry i to entry i + 1.
+// Entries with LFX_KEYFRAME set start a keyframe, coded against a black
+// frame; all others are XOR deltas against the previous frame, and an empty
+// one repeats it. A frame is a list of runs, each led by a control byte:
+//     0nnnnnnn            n + 1 literal pixels follow (3 bytes each)
+//     1nnnnnnn r g b      n + 1 copies of one pixel
+// A repeated zero pixel leaves those pixels as they were, so unchanged
+// areas of a delta cost 4 bytes per 128 pixels.
+//
+// tools/lfx_encode.py writes both versions.
+
+struct LfxHeader {
+    char magic[4];      // "LFX1" or "LFX2"
+    uint16_t width;     // 32
+    uint16_t height;    // 32
+    uint16_t frames;    // number of frames
+    uint8_t format;     // LFX_FORMAT_*
+} __attribute__((packed));
+
+struct LfxPaletteHeader {
+    uint8_t colors;     // Palette entries - 1
+    uint8_t flags;      // LFX_PALETTE_*
+} __attribute__((packed));
+
+struct LfxPhysicalHeader {
+    uint32_t mappingHash;   // MatrixOrientation::getMappingHash() of the wall
+    uint32_t sourceBytes;   // Size of the clip it was baked from
+    uint32_t sourceTime;    // and its last write time (File::getLastWrite())
+} __attribute__((packed));
+
+#define LFX_FORMAT_RGB888 0
+#define LFX_FORMAT_DELTA_RLE 1
+#define LFX_FORMAT_INDEXED8 2
+#define LFX_FORMAT_INDEXED4 3
+#define LFX_FORMAT_RGB888_PHYSICAL 4
+
+#define LFX_PALETTE_PER_FRAME 0x01
+
+#define LFX_KEYFRAME 0x80000000u    // Offset table flag
+#define LFX_RUN 0x80                // Control byte: repeated pixel
+#define LFX_MAX_RUN 128
+
+#endif // LFX_FORMAT_H
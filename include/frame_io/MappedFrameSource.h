@@ -0,0 +1,46 @@
+#ifndef MAPPED_FRAME_SOURCE_H
+#define MAPPED_FRAME_SOURCE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "IFrameSource.h"
+#include "LfxDecoder.h"
+
+// LFX clip that is already in the address space: a clip of the memory-mapped
+// clip partition (ClipPartition), or any clip loaded into RAM. Raw RGB888
+// frames are handed out in place by getFramePointer(), with no read and no
+// copy; indexed clips expand straight from the mapping and LFX2 clips decode
+// from it.
+class MappedFrameSource : public IFrameSource {
+private:
+    const uint8_t* clip;
+    uint32_t clipSize;
+    LfxHeader header;
+    bool valid;
+
+    const uint8_t* frames;      // Fixed-size frames: frame 0
+    uint32_t frameStride;
+    uint8_t indexBits;          // Indexed clips: 8 or 4, 0 = not indexed
+    bool framePalettes;
+    uint8_t palette[256 * 3];   // Copied out and padded, so stray indices stay in bounds
+    uint16_t paletteBytes;
+
+    LfxMemoryReader reader;
+    LfxDecoder* decoder;        // LFX2 clips only
+
+    bool openIndexed();
+
+public:
+    MappedFrameSource(const uint8_t* clipData, uint32_t size);
+    ~MappedFrameSource();
+
+    bool isValid() const { return valid; }
+
+    uint16_t getFrameCount() const override { return valid ? header.frames : 0; }
+
+    void getFrameInto(uint16_t frameIndex, CRGB* ledsOut) override;
+
+    const CRGB* getFramePointer(uint16_t frameIndex) override;
+};
+
+#endif // MAPPED_FRAME_SOURCE_H
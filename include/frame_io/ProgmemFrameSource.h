@@ -21,6 +21,12 @@ public:
         // Copy from flash (PROGMEM) to RAM
         memcpy_P(ledsOut, src, 1024 * sizeof(CRGB));
     }
+
+    // Flash is memory-mapped on the ESP32, so frames can be read in place
+    const CRGB* getFramePointer(uint16_t frameIndex) override {
+        if (frameIndex >= frameCount) frameIndex = 0;
+        return framesProgmem + (frameIndex * 1024);
+    }
 };
 
 #endif // PROGMEM_FRAME_SOURCE_H
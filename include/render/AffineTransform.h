@@ -0,0 +1,114 @@
+#ifndef AFFINE_TRANSFORM_H
+#define AFFINE_TRANSFORM_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+
+// What to sample when a destination pixel maps outside the source canvas
+enum AffineEdge {
+    AFFINE_WRAP = 0,          // Tile the source
+    AFFINE_CLAMP = 1,         // Repeat the edge pixels
+    AFFINE_TRANSPARENT = 2    // Leave the destination pixel untouched
+};
+
+static_assert((TOTAL_SIZE & (TOTAL_SIZE - 1)) == 0, "AFFINE_WRAP masks coordinates, TOTAL_SIZE must be a power of two");
+
+// Rotate / scale / shear / translate a TOTAL_SIZE x TOTAL_SIZE canvas about its centre.
+// The inverse mapping (destination -> source) is computed once per frame in
+// Q16.16; apply() then walks each destination row by adding the per-column
+// step, so a pixel costs two adds and one lookup with no trig in the loop.
+class AffineTransform {
+private:
+    int32_t du, dv;       // Source step per destination column (Q16.16)
+    int32_t duRow, dvRow; // Source step per destination row
+    int32_t u0, v0;       // Source position of destination pixel (0, 0)
+
+public:
+    AffineTransform() { setIdentity(); }
+
+    void setIdentity() { set(0, 256, 256, 0, 0, 0); }
+
+    // angle: 65536 = full turn (FastLED sin16/cos16 units)
+    // scaleX/scaleY: Q8.8, 256 = 1:1, larger zooms in
+    // shear: Q8.8 horizontal shear applied before rotation
+    // translateX/translateY: Q8.8 destination pixels
+    void set(uint16_t angle, uint16_t scaleX, uint16_t scaleY, int16_t shear,
+             int16_t translateX, int16_t translateY) {
+        if (scaleX == 0) scaleX = 1;
+        if (scaleY == 0) scaleY = 1;
+
+        int32_t c = (int32_t)cos16(angle) * 2;   // Q15 -> Q16
+        int32_t s = (int32_t)sin16(angle) * 2;
+        int32_t k = (int32_t)shear << 8;
+        int32_t sx = (int32_t)scaleX << 8;
+        int32_t sy = (int32_t)scaleY << 8;
+
+        // Inverse of R(angle) * Shear(k) * Scale(sx, sy):
+        //   [ (c + k*s)/sx   (s - k*c)/sx ]
+        //   [     -s/sy          c/sy     ]
+        int32_t ks = (int32_t)(((int64_t)k * s) >> 16);
+        int32_t kc = (int32_t)(((int64_t)k * c) >> 16);
+        int32_t ia = (int32_t)(((int64_t)(c + ks) << 16) / sx);
+        int32_t ib = (int32_t)(((int64_t)(s - kc) << 16) / sx);
+        int32_t ic = (int32_t)(((int64_t)-s << 16) / sy);
+        int32_t id = (int32_t)(((int64_t)c << 16) / sy);
+
+        // Sample at pixel centres, rotating about the canvas centre
+        const int32_t centre = (int32_t)TOTAL_SIZE << 15;
+        int32_t dx = 0x8000 - centre - ((int32_t)translateX << 8);
+        int32_t dy = 0x8000 - centre - ((int32_t)translateY << 8);
+
+        du = ia;
+        dv = ic;
+        duRow = ib;
+        dvRow = id;
+        u0 = (int32_t)(((int64_t)ia * dx + (int64_t)ib * dy) >> 16) + centre;
+        v0 = (int32_t)(((int64_t)ic * dx + (int64_t)id * dy) >> 16) + centre;
+    }
+
+    void apply(const CRGB src[TOTAL_SIZE][TOTAL_SIZE], CRGB dst[TOTAL_SIZE][TOTAL_SIZE], AffineEdge edge) const {
+        const int32_t mask = TOTAL_SIZE - 1;
+        int32_t uRow = u0;
+        int32_t vRow = v0;
+
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            CRGB* out = dst[y];
+            int32_t u = uRow;
+            int32_t v = vRow;
+
+            // Edge handling is chosen per row so each inner loop stays branch-light
+            switch (edge) {
+                case AFFINE_WRAP:
+                    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                        out[x] = src[(v >> 16) & mask][(u >> 16) & mask];
+                        u += du;
+                        v += dv;
+                    }
+                    break;
+                case AFFINE_CLAMP:
+                    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                        out[x] = src[constrain(v >> 16, 0, mask)][constrain(u >> 16, 0, mask)];
+                        u += du;
+                        v += dv;
+                    }
+                    break;
+                case AFFINE_TRANSPARENT:
+                    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                        // One unsigned compare per axis covers both bounds
+                        uint32_t su = (uint32_t)(u >> 16);
+                        uint32_t sv = (uint32_t)(v >> 16);
+                        if (su < TOTAL_SIZE && sv < TOTAL_SIZE) out[x] = src[sv][su];
+                        u += du;
+                        v += dv;
+                    }
+                    break;
+            }
+
+            uRow += duRow;
+            vRow += dvRow;
+        }
+    }
+};
+
+#endif // AFFINE_TRANSFORM_H
@@ -0,0 +1,75 @@
+#ifndef BAND_WORKER_POOL_H
+#define BAND_WORKER_POOL_H
+
+#include <stdint.h>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#define MAX_RENDER_BANDS 4
+
+// Splits a frame into horizontal bands and renders them concurrently.
+// The calling thread renders band 0 itself, one worker per remaining band
+// renders the rest, and run() returns only after every band has finished
+// (the barrier before the remap pass).
+//
+// On the ESP32-S3 the workers are FreeRTOS tasks pinned to the other core;
+// on a host build they are std::threads so the pool can be exercised and
+// timed off-device.
+class BandWorkerPool {
+public:
+    typedef void (*BandFn)(void* ctx, uint8_t yStart, uint8_t yEnd);
+
+    BandWorkerPool();
+    ~BandWorkerPool();
+
+    // Start workers for bandCount bands (including the caller's). 1 = serial.
+    bool begin(uint8_t bandCount);
+    void end();
+
+    uint8_t getBandCount() const { return bandCount; }
+
+    // Render rows [0, rows) split into getBandCount() bands; blocks until all are done
+    void run(BandFn fn, void* ctx, uint8_t rows);
+
+private:
+    struct Worker {
+        BandWorkerPool* pool;
+        uint8_t band;
+#if defined(ARDUINO)
+        TaskHandle_t task;
+#else
+        std::thread thread;
+#endif
+    };
+
+    uint8_t bandCount;
+    volatile bool stopping;
+    Worker workers[MAX_RENDER_BANDS - 1];
+
+    // Current job, published before the workers are released
+    BandFn jobFn;
+    void* jobCtx;
+    uint8_t jobRows;
+
+#if defined(ARDUINO)
+    SemaphoreHandle_t doneSem;
+    static void workerTask(void* param);
+#else
+    std::mutex mutex;
+    std::condition_variable startCv;
+    std::condition_variable doneCv;
+    uint32_t generation;
+    uint8_t pending;
+    static void workerThread(Worker* worker);
+#endif
+
+    void runBand(uint8_t band);
+};
+
+#endif // BAND_WORKER_POOL_H
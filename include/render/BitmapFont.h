@@ -0,0 +1,153 @@
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <LittleFS.h>
+#include "Animation.h"
+
+// Proportional bitmap font ("FNT1", written by tools/font_convert.py).
+//
+// Layout (little-endian):
+//   FontHeader
+//   FontGlyph glyphs[glyphCount]     sorted by codepoint
+//   FontKern kerning[kernCount]      sorted by (left, right)
+//   glyph bitmaps, column-major: width columns of columnBytes each
+//     1 bpp: bit r of the column = row r
+//     4 bpp: row r is the low (even r) or high (odd r) nibble of byte r / 2;
+//            0 = transparent, 15 = full coverage
+// One file holds one size; convert a face once per size needed.
+struct FontHeader {
+    char magic[4];              // "FNT1"
+    uint8_t height;             // Rows per glyph, 1..32
+    uint8_t baseline;           // Rows above the baseline
+    uint8_t bpp;                // 1 or 4
+    uint8_t reserved;
+    uint16_t glyphCount;
+    uint16_t kernCount;
+    uint16_t defaultCodepoint;  // Drawn for characters the font doesn't have
+    uint16_t reserved2;
+} __attribute__((packed));
+
+struct FontGlyph {
+    uint16_t codepoint;
+    uint8_t width;              // Bitmap columns
+    uint8_t advance;            // Pen movement after this glyph
+    int8_t xOffset;             // Bitmap position relative to the pen
+    uint8_t reserved;
+    uint32_t offset;            // Bitmap offset from the start of the bitmap section
+} __attribute__((packed));
+
+struct FontKern {
+    uint16_t left;
+    uint16_t right;
+    int8_t adjust;              // Added to the left glyph's advance
+    uint8_t reserved;
+} __attribute__((packed));
+
+#define FONT_CACHE_SLOTS 16
+#define FONT_CACHE_SLOT_BYTES 192   // e.g. 24 columns of a 16-row 4-bit font
+#define FONT_WIDTH_CACHE 8
+#define FONT_WIDTH_CACHE_BYTES 48   // Longer strings are measured every time
+
+// Position while walking a UTF-8 string through a font with nextGlyph()
+struct GlyphCursor {
+    const char* next;           // Undecoded remainder of the string
+    int32_t pen;                // Pen x after the last glyph returned (long strings pass 32767)
+    uint16_t previous;          // Last glyph's codepoint, for kerning (0 = none)
+
+    explicit GlyphCursor(const char* text, int32_t x = 0) : next(text), pen(x), previous(0) {}
+};
+
+// A font either lives in memory (the built-in 5x7 font, or an FNT1 blob in
+// flash) or is streamed from LittleFS: then the glyph and kerning tables are
+// held in RAM and glyph bitmaps are read on demand through a small LRU cache,
+// so text that is redrawn doesn't go back to flash.
+class BitmapFont {
+private:
+    FontHeader header;
+    const FontGlyph* glyphs;
+    const FontKern* kerning;
+    const uint8_t* bitmaps;     // Memory fonts: the bitmap section
+    uint8_t* tables;            // Streamed and built-in fonts: glyph + kerning tables (owned)
+    File file;
+    uint32_t bitmapStart;       // Streamed fonts: file offset of the bitmap section
+    uint8_t columnBytes;
+    const FontGlyph* fallback;
+    uint16_t generation;        // Bumped on release(), so layouts notice a reload
+
+    struct CacheSlot {
+        const FontGlyph* glyph;
+        uint32_t lastUse;
+        uint8_t data[FONT_CACHE_SLOT_BYTES];
+    } cache[FONT_CACHE_SLOTS];
+    uint32_t useClock;
+    uint32_t cacheHits;
+    uint32_t cacheMisses;
+
+    struct WidthEntry {
+        uint32_t hash;
+        uint16_t length;
+        uint16_t width;
+        char text[FONT_WIDTH_CACHE_BYTES];  // The string measured, to confirm a hash match
+    } widths[FONT_WIDTH_CACHE];
+    uint8_t nextWidth;
+
+    bool parse(const uint8_t* data, size_t size);
+    void resetCaches();
+
+public:
+    BitmapFont();
+    ~BitmapFont() { release(); }
+
+    // Stream a font from LittleFS (tables in RAM, bitmaps through the glyph cache)
+    bool load(const char* path);
+
+    // Use an FNT1 font compiled into flash; not copied
+    bool loadFromMemory(const uint8_t* data, size_t size);
+
+    // The built-in 5x7 font: ASCII plus common Latin-1 letters and symbols
+    // (fixed 6-pixel advance, no kerning)
+    static BitmapFont& builtin();
+
+    void release();
+
+    bool isValid() const { return glyphs != nullptr; }
+    uint8_t getHeight() const { return header.height; }
+    uint8_t getBaseline() const { return header.baseline; }
+    uint8_t getBpp() const { return header.bpp; }
+    uint16_t getGlyphCount() const { return header.glyphCount; }
+    uint16_t getGeneration() const { return generation; }
+
+    // Glyph for a codepoint (binary search over the sorted, sparse glyph
+    // table), or the font's default glyph
+    const FontGlyph* findGlyph(uint32_t codepoint) const;
+
+    // Decode the next UTF-8 character at the cursor and apply kerning and
+    // advance; returns its glyph with left = x of the bitmap's first column,
+    // or nullptr at the end of the string
+    const FontGlyph* nextGlyph(GlyphCursor& cursor, int32_t& left) const;
+
+    // Advance adjustment between two adjacent codepoints (0 if no pair)
+    int8_t getKerning(uint16_t left, uint16_t right) const;
+
+    // The glyph's column-major bitmap, in RAM for at least as long as the next
+    // getGlyphBitmap() call
+    const uint8_t* getGlyphBitmap(const FontGlyph* glyph);
+
+    // Coverage of one bitmap pixel: 0..15 (1-bit fonts give 0 or 15)
+    uint8_t coverage(const uint8_t* bitmap, uint8_t col, uint8_t row) const {
+        const uint8_t* column = bitmap + col * columnBytes;
+        if (header.bpp == 1) return (column[row >> 3] >> (row & 7)) & 1 ? 15 : 0;
+        return (column[row >> 1] >> ((row & 1) << 2)) & 0x0F;
+    }
+
+    // Width of the inked extent of UTF-8 text in pixels (advances plus
+    // kerning), remembered for the last few strings measured
+    uint16_t getTextWidth(const char* text);
+
+    uint32_t getCacheHits() const { return cacheHits; }
+    uint32_t getCacheMisses() const { return cacheMisses; }
+};
+
+#endif // BITMAP_FONT_H
@@ -0,0 +1,25 @@
+// Generated by tools/sprite_encode.py from invader.png - do not edit
+#pragma once
+#include <Arduino.h>
+
+static const uint8_t SPRITE_INVADER[] PROGMEM = {
+    0x53, 0x50, 0x52, 0x31, 0x0b, 0x00, 0x08, 0x00, 0x02, 0x00, 0xff, 0x00, 0xff, 0x00, 0x16, 0x00,
+    0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x2c, 0x00, 0x48, 0x00,
+    0x4e, 0x00, 0x5e, 0x00, 0x73, 0x00, 0x02, 0x02, 0x01, 0x3c, 0xff, 0x3c, 0x05, 0x01, 0x3c, 0xff,
+    0x3c, 0x02, 0x03, 0x01, 0x3c, 0xff, 0x3c, 0x03, 0x01, 0x3c, 0xff, 0x3c, 0x01, 0x02, 0x87, 0x3c,
+    0xff, 0x3c, 0x03, 0x01, 0x03, 0x3c, 0xff, 0x3c, 0x3c, 0xff, 0x3c, 0xff, 0xff, 0xff, 0x00, 0x83,
+    0x3c, 0xff, 0x3c, 0x00, 0x03, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x3c, 0x3c, 0xff, 0x3c, 0x01, 0x00,
+    0x8b, 0x3c, 0xff, 0x3c, 0x03, 0x00, 0x01, 0x3c, 0xff, 0x3c, 0x01, 0x87, 0x3c, 0xff, 0x3c, 0x01,
+    0x01, 0x3c, 0xff, 0x3c, 0x04, 0x00, 0x01, 0x3c, 0xff, 0x3c, 0x01, 0x01, 0x3c, 0xff, 0x3c, 0x05,
+    0x01, 0x3c, 0xff, 0x3c, 0x01, 0x01, 0x3c, 0xff, 0x3c, 0x02, 0x03, 0x02, 0x3c, 0xff, 0x3c, 0x3c,
+    0xff, 0x3c, 0x01, 0x02, 0x3c, 0xff, 0x3c, 0x3c, 0xff, 0x3c, 0x10, 0x00, 0x1b, 0x00, 0x30, 0x00,
+    0x40, 0x00, 0x5a, 0x00, 0x60, 0x00, 0x66, 0x00, 0x71, 0x00, 0x02, 0x02, 0x01, 0x3c, 0xff, 0x3c,
+    0x05, 0x01, 0x3c, 0xff, 0x3c, 0x04, 0x00, 0x01, 0x3c, 0xff, 0x3c, 0x02, 0x01, 0x3c, 0xff, 0x3c,
+    0x03, 0x01, 0x3c, 0xff, 0x3c, 0x02, 0x01, 0x3c, 0xff, 0x3c, 0x03, 0x00, 0x01, 0x3c, 0xff, 0x3c,
+    0x01, 0x87, 0x3c, 0xff, 0x3c, 0x01, 0x01, 0x3c, 0xff, 0x3c, 0x05, 0x00, 0x83, 0x3c, 0xff, 0x3c,
+    0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x83, 0x3c, 0xff, 0x3c, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00,
+    0x83, 0x3c, 0xff, 0x3c, 0x01, 0x00, 0x8b, 0x3c, 0xff, 0x3c, 0x01, 0x01, 0x89, 0x3c, 0xff, 0x3c,
+    0x02, 0x02, 0x01, 0x3c, 0xff, 0x3c, 0x05, 0x01, 0x3c, 0xff, 0x3c, 0x02, 0x01, 0x01, 0x3c, 0xff,
+    0x3c, 0x07, 0x01, 0x3c, 0xff, 0x3c,
+};
+static const size_t SPRITE_INVADER_SIZE = 278;
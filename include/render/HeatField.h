@@ -0,0 +1,99 @@
+#ifndef HEAT_FIELD_H
+#define HEAT_FIELD_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/Palette.h"
+
+// uint8 heat map the size of the canvas, with row-wise simulation kernels for
+// fire-like effects. All arithmetic saturates, so heat never wraps around.
+// Row 0 is the top of the canvas; heat rises towards it.
+class HeatField {
+private:
+    uint8_t heat[TOTAL_SIZE][TOTAL_SIZE];
+    uint16_t rng;
+
+    // xorshift16: cheap enough to call per cell
+    inline uint8_t nextRandom() {
+        rng ^= rng << 7;
+        rng ^= rng >> 9;
+        rng ^= rng << 8;
+        return rng >> 8;
+    }
+
+public:
+    HeatField() : rng(0xACE1) { clear(); }
+
+    void clear() { memset(heat, 0, sizeof(heat)); }
+    void seed(uint16_t s) { rng = s ? s : 0xACE1; }
+
+    uint8_t* row(uint8_t y) { return heat[y]; }
+
+    // Subtract a random amount in [0, maxCooling] from every cell
+    void cool(uint8_t maxCooling) {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            uint8_t* r = heat[y];
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                r[x] = qsub8(r[x], scale8(nextRandom(), maxCooling));
+            }
+        }
+    }
+
+    // Convection: each row takes a weighted blur of the two rows below it.
+    // drift shifts the source columns sideways (0 = straight up), for smoke.
+    void rise(int8_t drift) {
+        for (uint8_t y = 0; y + 2 < TOTAL_SIZE; y++) {
+            const uint8_t* below = heat[y + 1];
+            const uint8_t* below2 = heat[y + 2];
+            uint8_t* r = heat[y];
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                int16_t sx = constrain((int16_t)x + drift, 0, TOTAL_SIZE - 1);
+                uint8_t xl = sx > 0 ? sx - 1 : 0;
+                uint8_t xr = sx < TOTAL_SIZE - 1 ? sx + 1 : TOTAL_SIZE - 1;
+                uint16_t near = (below[xl] + 2 * below[sx] + below[xr]) >> 2;
+                r[x] = (3 * near + below2[sx]) >> 2;
+            }
+        }
+    }
+
+    // Isotropic 4-neighbour diffusion, for slow-moving lava
+    void diffuse() {
+        uint8_t prev[TOTAL_SIZE];
+        memcpy(prev, heat[0], sizeof(prev));
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            uint8_t* r = heat[y];
+            const uint8_t* below = heat[y + 1 < TOTAL_SIZE ? y + 1 : y];
+            uint8_t left = r[0];
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                uint8_t centre = r[x];
+                uint8_t right = r[x + 1 < TOTAL_SIZE ? x + 1 : x];
+                r[x] = (4 * centre + prev[x] + below[x] + left + right) >> 3;
+                prev[x] = centre;
+                left = centre;
+            }
+        }
+    }
+
+    // Add up to 'amount' heat at 'count' random cells in rows [yStart, yEnd)
+    void spark(uint8_t yStart, uint8_t yEnd, uint8_t count, uint8_t amount) {
+        for (uint8_t i = 0; i < count; i++) {
+            uint8_t x = scale8(nextRandom(), TOTAL_SIZE - 1);
+            uint8_t y = yStart + scale8(nextRandom(), yEnd - yStart - 1);
+            heat[y][x] = qadd8(heat[y][x], qadd8(amount / 2, scale8(nextRandom(), amount / 2)));
+        }
+    }
+
+    // Map heat to color through a 256-entry palette
+    void render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const Palette& palette) const {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            const uint8_t* r = heat[y];
+            CRGB* out = buffer[y];
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                out[x] = palette.lookup(r[x]);
+            }
+        }
+    }
+};
+
+#endif // HEAT_FIELD_H
@@ -0,0 +1,76 @@
+#ifndef NOISE_FIELD_H
+#define NOISE_FIELD_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/Palette.h"
+
+#define NOISE_MAX_OCTAVES 3
+
+// Animated 2D gradient (Perlin) noise over the canvas, in fixed point.
+//
+// Time is treated as a third lattice axis, but instead of evaluating 3D noise
+// per pixel, the field keeps whole 2D noise planes for the lattice time steps
+// k and k+1 and blends them by the smoothed fraction of t each frame (one lerp
+// per pixel). Planes stay valid for a whole time cell, so consecutive frames
+// share all lattice work; the plane for k+2 is built a few rows per frame while
+// k..k+1 is displayed, so crossing into the next time cell costs no spike.
+// Within a plane, lattice gradients are looked up once per cell row and shared
+// by every pixel row in that cell.
+class NoiseField {
+private:
+    uint8_t planes[3][TOTAL_SIZE][TOTAL_SIZE];
+    uint8_t field[TOTAL_SIZE][TOTAL_SIZE];   // Blended output, 0..255
+    uint8_t current;         // Plane slot holding time step k (k+1, k+2 follow)
+    int32_t step;            // Time lattice step k of the current plane
+    uint8_t builtRows;       // Rows of plane k+2 built so far
+    bool primed;
+
+    uint8_t cellShift;       // log2 of the coarsest lattice cell in pixels
+    uint8_t octaves;
+    uint16_t seed;
+    uint32_t updateUs;
+
+    // Per octave: gradients of the lattice corner rows above and below the last cell row
+    struct GradientCache {
+        int32_t plane;
+        int16_t cellY;
+        int8_t gx[2][TOTAL_SIZE / 2 + 1];
+        int8_t gy[2][TOTAL_SIZE / 2 + 1];
+    } cache[NOISE_MAX_OCTAVES];
+
+    uint8_t hashGradient(int16_t ix, int16_t iy, int32_t plane, uint8_t octave) const;
+    void perlinRow(int16_t* acc, int32_t plane, uint8_t y, uint8_t octave);
+    void buildRow(uint8_t slot, int32_t plane, uint8_t y);
+    void buildPlane(uint8_t slot, int32_t plane);
+
+public:
+    NoiseField();
+
+    // cellSize: coarsest lattice cell in pixels (power of two, 2..32);
+    // octaves: 1..NOISE_MAX_OCTAVES, each halves the cell size and amplitude
+    void configure(uint8_t cellSize, uint8_t octaves, uint16_t seed);
+
+    // Advance to time t (Q8.8 time lattice steps; 256 = one step)
+    void update(uint32_t time);
+
+    // Force all planes to be rebuilt on the next update
+    void invalidate() { primed = false; }
+
+    uint8_t value(uint8_t x, uint8_t y) const { return field[y][x]; }
+    const uint8_t* row(uint8_t y) const { return field[y]; }
+
+    // Map the field through a palette; offset rotates the palette
+    void render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const Palette& palette, uint8_t offset = 0) const;
+
+    // Time spent in the last update(), for comparison with per-pixel inoise8
+    uint32_t getUpdateUs() const { return updateUs; }
+
+    // Time 'frames' single-octave updates of this field against per-pixel
+    // inoise8 over the same grid and print both to Serial (tools/noise_bench.cpp
+    // runs it on the host)
+    static void benchmark(uint16_t frames);
+};
+
+#endif // NOISE_FIELD_H
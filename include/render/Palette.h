@@ -0,0 +1,140 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+// Gradient stop used to build a palette. Flash-resident gradients use the same
+// layout as FastLED gradient palettes: {index, r, g, b} repeated, ending with a
+// stop at index 255.
+struct GradientStop {
+    uint8_t index;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+};
+
+// Built-in gradients stored in flash
+namespace PaletteGradients {
+    // Black -> red -> yellow -> white
+    static const uint8_t Heat[] PROGMEM = {
+          0,   0,   0,   0,
+         96, 255,   0,   0,
+        192, 255, 255,   0,
+        255, 255, 255, 255
+    };
+    // Black -> deep red -> orange -> yellow, mostly dark
+    static const uint8_t Lava[] PROGMEM = {
+          0,   0,   0,   0,
+        112, 128,   0,   0,
+        192, 255,  64,   0,
+        240, 255, 192,   0,
+        255, 255, 255, 128
+    };
+    // Black -> purple-grey -> pale grey
+    static const uint8_t Smoke[] PROGMEM = {
+          0,   0,   0,   0,
+        128,  64,  40,  80,
+        255, 200, 200, 210
+    };
+    // Deep blue -> cyan -> white
+    static const uint8_t Ocean[] PROGMEM = {
+          0,   0,   0,  32,
+        128,   0, 128, 255,
+        224,  64, 255, 255,
+        255, 255, 255, 255
+    };
+}
+
+// 256-entry RGB lookup table. Procedural effects compute an 8-bit index (or an
+// 8.8 fixed-point position) per pixel and read the color from the table
+// instead of converting HSV per pixel.
+class Palette {
+private:
+    CRGB entries[256];
+
+    void fillSegment(uint8_t i0, CRGB c0, uint8_t i1, CRGB c1) {
+        uint16_t span = i1 - i0;
+        for (uint16_t i = i0; i < i1; i++) {
+            uint8_t f = ((i - i0) * 256) / span;
+            entries[i] = CRGB(lerp8by8(c0.r, c1.r, f), lerp8by8(c0.g, c1.g, f), lerp8by8(c0.b, c1.b, f));
+        }
+        entries[i1] = c1;
+    }
+
+public:
+    Palette() { fillSolid(CRGB::Black); }
+
+    void fillSolid(CRGB color) {
+        for (uint16_t i = 0; i < 256; i++) entries[i] = color;
+    }
+
+    // Sweep hueSpan hues (256 = full wheel) starting at hueStart with constant sat/val
+    void fromHsvRange(uint8_t hueStart, uint16_t hueSpan, uint8_t sat, uint8_t val) {
+        for (uint16_t i = 0; i < 256; i++) {
+            uint8_t hue = hueStart + ((i * hueSpan) >> 8);
+            entries[i] = CHSV(hue, sat, val);
+        }
+    }
+
+    // Linear interpolation between stops (sorted by index, first at 0, last at 255)
+    void fromGradient(const GradientStop* stops, uint8_t count) {
+        if (count == 0) return;
+        for (uint8_t s = 0; s + 1 < count; s++) {
+            fillSegment(stops[s].index, CRGB(stops[s].r, stops[s].g, stops[s].b),
+                        stops[s + 1].index, CRGB(stops[s + 1].r, stops[s + 1].g, stops[s + 1].b));
+        }
+        if (count == 1) fillSolid(CRGB(stops[0].r, stops[0].g, stops[0].b));
+    }
+
+    // Same, reading a {index, r, g, b} byte gradient from flash
+    void fromGradient_P(const uint8_t* progmemStops) {
+        GradientStop prev;
+        memcpy_P(&prev, progmemStops, sizeof(prev));
+        if (prev.index == 255) {
+            fillSolid(CRGB(prev.r, prev.g, prev.b));
+            return;
+        }
+        for (const uint8_t* p = progmemStops + sizeof(GradientStop); ; p += sizeof(GradientStop)) {
+            GradientStop next;
+            memcpy_P(&next, p, sizeof(next));
+            fillSegment(prev.index, CRGB(prev.r, prev.g, prev.b), next.index, CRGB(next.r, next.g, next.b));
+            if (next.index == 255) break;
+            prev = next;
+        }
+    }
+
+    // Load {"hsv": [hueStart, hueSpan, sat, val]} or {"stops": [[i, r, g, b], ...]}
+    bool loadFromJson(const char* path);
+
+    CRGB& operator[](uint8_t index) { return entries[index]; }
+    const CRGB& lookup(uint8_t index) const { return entries[index]; }
+
+    // Fixed-point sample: pos is 8.8, blending the two neighbouring entries
+    CRGB sample(uint16_t pos) const {
+        const CRGB& a = entries[pos >> 8];
+        const CRGB& b = entries[(uint8_t)((pos >> 8) + 1)];
+        uint8_t f = pos & 0xFF;
+        return CRGB(lerp8by8(a.r, b.r, f), lerp8by8(a.g, b.g, f), lerp8by8(a.b, b.b, f));
+    }
+
+    // Row-incremental lookup: index starts at start (8.8) and advances by step per pixel
+    void fillRow(CRGB* row, uint8_t count, uint16_t start, int16_t step) const {
+        uint16_t pos = start;
+        for (uint8_t i = 0; i < count; i++) {
+            row[i] = entries[pos >> 8];
+            pos += step;
+        }
+    }
+
+    // Same stepping, but interpolating between entries for smooth gradients
+    void fillRowSmooth(CRGB* row, uint8_t count, uint16_t start, int16_t step) const {
+        uint16_t pos = start;
+        for (uint8_t i = 0; i < count; i++) {
+            row[i] = sample(pos);
+            pos += step;
+        }
+    }
+};
+
+#endif // PALETTE_H
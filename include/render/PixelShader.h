@@ -0,0 +1,109 @@
+#ifndef PIXEL_SHADER_H
+#define PIXEL_SHADER_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/Palette.h"
+
+// Stack-based bytecode VM for per-pixel palette effects.
+//
+// Programs are compiled on the host by tools/shader_compile.py from a tiny
+// expression language over x, y and t. The compiler hoists sub-expressions by
+// what they depend on, so the file holds three code segments:
+//   frame: runs once per frame (depends only on t)
+//   row:   runs once per row (depends on y and t)
+//   pixel: runs per pixel and leaves the palette position on the stack
+// Hoisted values are passed between segments through registers.
+//
+// All values are Q8.8 fixed point in int32. x and y are pixel coordinates,
+// t is seconds. The pixel result is an 8.8 palette position (integer part is
+// the palette index, fraction blends to the next entry).
+
+#define SHADER_STACK_SIZE 16
+#define SHADER_MAX_REGS 32
+#define SHADER_MAX_CODE 1024
+
+struct ShaderHeader {
+    char magic[4];        // "PSH1"
+    uint8_t regCount;     // hoisted registers
+    uint8_t flags;        // SHADER_FLAG_*
+    uint16_t frameLen;    // bytes of per-frame code
+    uint16_t rowLen;      // bytes of per-row code
+    uint16_t pixelLen;    // bytes of per-pixel code
+    uint8_t stopCount;    // palette gradient stops that follow (0 = rainbow)
+    uint8_t reserved;
+} __attribute__((packed));
+// Followed by: stopCount * {index, r, g, b}, the lookup table if
+// SHADER_FLAG_TABLE is set (256 x int16 Q8.8), then frame, row and pixel code.
+
+#define SHADER_FLAG_TABLE 0x01
+#define SHADER_SYMMETRY_SHIFT 1      // flags bits 1-3: declared RenderSymmetry
+#define SHADER_SYMMETRY_MASK 0x0E
+
+enum ShaderOp : uint8_t {
+    OP_CONST = 1,   // push int32 immediate
+    OP_X,           // push x
+    OP_Y,           // push y
+    OP_T,           // push t
+    OP_LOAD,        // push register (uint8 operand)
+    OP_STORE,       // pop into register (uint8 operand)
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_MOD,
+    OP_NEG,
+    OP_MIN,
+    OP_MAX,
+    OP_ABS,
+    OP_FRAC,
+    OP_SIN,         // sin of turns (1.0 = full circle), result -1..1
+    OP_COS,
+    OP_NOISE2,      // 2D Perlin noise, one lattice cell per 1.0, result 0..1
+    OP_NOISE3,      // 3D Perlin noise
+    OP_LUT,         // table[int(v) & 255]
+    OP_COUNT
+};
+
+class PixelShader {
+private:
+    uint8_t code[SHADER_MAX_CODE];
+    uint16_t frameLen;
+    uint16_t rowLen;
+    uint16_t pixelLen;
+    uint8_t regCount;
+    int16_t table[256];
+    Palette palette;
+    RenderSymmetry symmetry;
+    bool valid;
+
+    // Check operands, stack depth and which inputs each segment may read
+    bool validateSegment(const uint8_t* seg, uint16_t len, uint8_t allowedInputs, uint8_t resultDepth) const;
+
+public:
+    PixelShader();
+
+    // Load a compiled .psb program from LittleFS
+    bool load(const char* path);
+
+    // Load from memory (e.g. a PROGMEM blob copied to RAM)
+    bool loadFromMemory(const uint8_t* data, size_t size);
+
+    bool isValid() const { return valid; }
+    const Palette& getPalette() const { return palette; }
+    RenderSymmetry getSymmetry() const { return symmetry; }
+
+    // Run one segment. regs must hold SHADER_MAX_REGS entries and be private to
+    // the caller, which makes rendering re-entrant across render bands.
+    int32_t run(const uint8_t* seg, uint16_t len, int32_t* regs, int32_t x, int32_t y, int32_t t) const;
+
+    // Render rows [yStart, yEnd) of a width-pixel-wide canvas whose pixels are
+    // scale logical pixels apart (scale > 1 for reduced-resolution rendering).
+    // upperTriangle skips pixels with x < y (the 8-fold fundamental region).
+    void renderRows(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime,
+                    uint8_t yStart, uint8_t yEnd, uint8_t width, uint8_t scale,
+                    bool upperTriangle = false) const;
+};
+
+#endif // PIXEL_SHADER_H
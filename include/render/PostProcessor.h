@@ -0,0 +1,85 @@
+#ifndef POST_PROCESSOR_H
+#define POST_PROCESSOR_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+
+#define MAX_POST_PASSES 8
+
+enum PostPassType : uint8_t {
+    POST_BLUR = 0,          // p0 = radius (1..3), p1 = kernel (0 box, 1 gaussian)
+    POST_TRAILS = 1,        // p0 = fade per frame (0 = never fades, 255 = no trails)
+    POST_LEVELS = 2,        // p0 = brightness (255 = unchanged), p1 = contrast (128 = unchanged)
+    POST_MIRROR = 3,        // p0 = POST_MIRROR_H and/or POST_MIRROR_V
+    POST_KALEIDOSCOPE = 4   // top-left quadrant reflected into the other three
+};
+
+#define POST_MIRROR_H 0x01  // left half reflected onto the right
+#define POST_MIRROR_V 0x02  // top half reflected onto the bottom
+
+struct PostPass {
+    PostPassType type;
+    uint8_t p0;
+    uint8_t p1;
+};
+
+// Post-processing chain applied between an animation's render and the matrix remap.
+// The first stage reads the animation's frame buffer and writes into the processor's
+// own output buffer, so animations that rely on their previous frame being left
+// untouched keep working. Passes are fixed point and run row by row; consecutive
+// row-local passes (trails, levels, horizontal mirror) are fused into a single sweep,
+// and the blur does its horizontal and vertical passes in one sweep via a row ring.
+class PostProcessor {
+private:
+    CRGB output[TOTAL_SIZE][TOTAL_SIZE];
+    CRGB history[TOTAL_SIZE][TOTAL_SIZE];   // Previous output, for trails
+    uint8_t levels[256];
+    uint8_t levelsBrightness;
+    uint8_t levelsContrast;
+    uint32_t passUs[MAX_POST_PASSES];
+
+    static bool isRowLocal(const PostPass& pass) {
+        return pass.type == POST_TRAILS || pass.type == POST_LEVELS ||
+               (pass.type == POST_MIRROR && pass.p0 == POST_MIRROR_H);
+    }
+
+    void applyRow(const PostPass& pass, CRGB* row, uint8_t y, uint8_t width);
+    void blur(uint8_t radius, bool gaussian, uint8_t width, uint8_t height);
+    void mirrorRows(uint8_t width, uint8_t height);
+    void kaleidoscope(uint8_t width, uint8_t height);
+    void buildLevels(uint8_t brightness, uint8_t contrast);
+
+public:
+    PostProcessor();
+
+    // Clear trail memory (call when the animation changes)
+    void reset();
+
+    // Run the chain over the top-left width x height region of 'source' and
+    // return the buffer holding the result (source itself when count is 0)
+    CRGB (*apply(CRGB source[TOTAL_SIZE][TOTAL_SIZE], const PostPass* passes, uint8_t count,
+                 uint8_t width, uint8_t height))[TOTAL_SIZE];
+
+    // Time spent in pass i during the last apply(). Fused passes are timed
+    // together and reported on the first pass of the group (the others read 0).
+    uint32_t getPassUs(uint8_t i) const { return i < MAX_POST_PASSES ? passUs[i] : 0; }
+
+    // Pass i runs in the same sweep as pass i - 1
+    static bool isFused(const PostPass* passes, uint8_t i) {
+        return i > 0 && isRowLocal(passes[i - 1]) && isRowLocal(passes[i]);
+    }
+
+    static const char* passName(PostPassType type) {
+        switch (type) {
+            case POST_BLUR: return "blur";
+            case POST_TRAILS: return "trails";
+            case POST_LEVELS: return "levels";
+            case POST_MIRROR: return "mirror";
+            case POST_KALEIDOSCOPE: return "kaleidoscope";
+        }
+        return "";
+    }
+};
+
+#endif // POST_PROCESSOR_H
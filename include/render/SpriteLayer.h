@@ -0,0 +1,120 @@
+#ifndef SPRITE_LAYER_H
+#define SPRITE_LAYER_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/SpriteSheet.h"
+
+#define SPRITE_LAYER_CAPACITY 64
+
+struct Sprite {
+    const SpriteSheet* sheet;
+    int16_t x;
+    int16_t y;
+    uint16_t frame;
+    bool visible;
+};
+
+// Sprites composited over a static background. The target buffer is assumed to
+// hold the previous composite (AnimationManager keeps its frame buffer between
+// frames), so each render only restores the background under the boxes the
+// sprites covered last frame and then draws the sprites again; everything else
+// is left untouched. Call invalidate() after the background or buffer changes.
+class SpriteLayer {
+private:
+    struct Box {
+        int8_t x0, y0, x1, y1;   // Clipped to the canvas; empty when x0 >= x1
+    };
+
+    CRGB background[TOTAL_SIZE][TOTAL_SIZE];
+    Sprite sprites[SPRITE_LAYER_CAPACITY];
+    Box drawn[SPRITE_LAYER_CAPACITY];
+    uint8_t count;
+    bool fullRedraw;
+    uint32_t restoredPixels;
+
+    static Box clipBox(const Sprite& s) {
+        Box b = {0, 0, 0, 0};
+        if (!s.visible || !s.sheet || !s.sheet->isValid()) return b;
+        int16_t x0 = max(s.x, (int16_t)0);
+        int16_t y0 = max(s.y, (int16_t)0);
+        int16_t x1 = min((int16_t)(s.x + s.sheet->getFrameWidth()), (int16_t)TOTAL_SIZE);
+        int16_t y1 = min((int16_t)(s.y + s.sheet->getFrameHeight()), (int16_t)TOTAL_SIZE);
+        if (x0 >= x1 || y0 >= y1) return b;
+        b.x0 = x0; b.y0 = y0; b.x1 = x1; b.y1 = y1;
+        return b;
+    }
+
+    void restore(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const Box& b) {
+        if (b.x0 >= b.x1) return;
+        size_t bytes = (b.x1 - b.x0) * sizeof(CRGB);
+        for (int8_t y = b.y0; y < b.y1; y++) {
+            memcpy(&buffer[y][b.x0], &background[y][b.x0], bytes);
+        }
+        restoredPixels += (b.x1 - b.x0) * (b.y1 - b.y0);
+    }
+
+public:
+    SpriteLayer() : count(0), fullRedraw(true), restoredPixels(0) {
+        memset(background, 0, sizeof(background));
+        memset(drawn, 0, sizeof(drawn));
+    }
+
+    void fillBackground(const CRGB& color) {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) background[y][x] = color;
+        }
+        fullRedraw = true;
+    }
+
+    void setBackground(const CRGB image[TOTAL_SIZE][TOTAL_SIZE]) {
+        memcpy(background, image, sizeof(background));
+        fullRedraw = true;
+    }
+
+    CRGB (*getBackground())[TOTAL_SIZE] { return background; }
+
+    // Force the next render to repaint the whole canvas
+    void invalidate() { fullRedraw = true; }
+
+    // Returns the new sprite's index, or -1 when the layer is full
+    int8_t add(const SpriteSheet* sheet, int16_t x, int16_t y, uint16_t frame = 0) {
+        if (count >= SPRITE_LAYER_CAPACITY) return -1;
+        sprites[count] = {sheet, x, y, frame, true};
+        drawn[count] = {0, 0, 0, 0};
+        return count++;
+    }
+
+    void clear() {
+        count = 0;
+        fullRedraw = true;
+    }
+
+    Sprite& get(uint8_t index) { return sprites[index]; }
+    uint8_t getCount() const { return count; }
+
+    // Background pixels restored by the last render (TOTAL_SIZE^2 on a full redraw)
+    uint32_t getRestoredPixels() const { return restoredPixels; }
+
+    void render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE]) {
+        restoredPixels = 0;
+        if (fullRedraw) {
+            memcpy(buffer, background, sizeof(background));
+            restoredPixels = TOTAL_SIZE * TOTAL_SIZE;
+            fullRedraw = false;
+        } else {
+            // Erase every sprite before drawing any, so overlapping sprites stay intact
+            for (uint8_t i = 0; i < count; i++) restore(buffer, drawn[i]);
+        }
+
+        // Sprites are drawn in index order; later sprites appear on top
+        for (uint8_t i = 0; i < count; i++) {
+            const Sprite& s = sprites[i];
+            drawn[i] = clipBox(s);
+            if (drawn[i].x0 < drawn[i].x1) s.sheet->blit(buffer, s.frame, s.x, s.y);
+        }
+    }
+};
+
+#endif // SPRITE_LAYER_H
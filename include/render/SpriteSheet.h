@@ -0,0 +1,65 @@
+#ifndef SPRITE_SHEET_H
+#define SPRITE_SHEET_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+
+// Run-length encoded, color-keyed sprite sheet ("SPR1", written by tools/sprite_encode.py).
+//
+// Layout (little-endian):
+//   SpriteSheetHeader
+//   uint32_t frameOffsets[frameCount]     offset of each frame from the start of the file
+//   per frame:
+//     uint16_t rowOffsets[frameHeight]    offset of each row from the start of the frame
+//     per row: uint8_t spanCount, then spanCount x { uint8_t skip; uint8_t len; payload }
+//       skip: transparent pixels before the span
+//       len & 0x80: solid span, payload is one RGB888 color repeated (len & 0x7F) times
+//       otherwise:  literal span, payload is len RGB888 pixels
+// Transparent pixels are never stored, so blits jump over them entirely, and the
+// row table lets vertical clipping start at the first visible row.
+struct SpriteSheetHeader {
+    char magic[4];          // "SPR1"
+    uint16_t frameWidth;
+    uint16_t frameHeight;
+    uint16_t frameCount;
+    uint8_t keyColor[3];    // color that was treated as transparent when encoding
+    uint8_t reserved;
+} __attribute__((packed));
+
+#define SPRITE_SPAN_SOLID 0x80
+#define SPRITE_SPAN_LENGTH 0x7F
+
+class SpriteSheet {
+private:
+    const uint8_t* data;        // Whole sheet: header, frame table, frame data
+    size_t size;
+    bool ownsData;              // Loaded into RAM (vs. flash, which the ESP32 maps into the address space)
+    SpriteSheetHeader header;
+
+    bool validate() const;
+
+public:
+    SpriteSheet() : data(nullptr), size(0), ownsData(false) {
+        memset(&header, 0, sizeof(header));
+    }
+    ~SpriteSheet() { release(); }
+
+    // Load a sheet file from LittleFS into RAM
+    bool load(const char* path);
+
+    // Use a sheet compiled into flash (sprite_encode.py --header); not copied
+    bool loadFromMemory(const uint8_t* sheet, size_t sheetSize);
+
+    void release();
+
+    bool isValid() const { return data != nullptr; }
+    uint16_t getFrameCount() const { return header.frameCount; }
+    uint16_t getFrameWidth() const { return header.frameWidth; }
+    uint16_t getFrameHeight() const { return header.frameHeight; }
+
+    // Draw a frame with its top-left corner at (x, y), clipped to the canvas
+    void blit(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint16_t frame, int16_t x, int16_t y) const;
+};
+
+#endif // SPRITE_SHEET_H
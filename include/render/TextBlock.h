@@ -0,0 +1,76 @@
+#ifndef TEXT_BLOCK_H
+#define TEXT_BLOCK_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/BitmapFont.h"
+#include "render/TextStrip.h"
+
+#define TEXT_BLOCK_LINE_BYTES 128   // UTF-8 bytes per line; longer runs are broken
+#define TEXT_BLOCK_STRIPS (TOTAL_SIZE / 4 + 2)   // Rasterized lines: a canvas of short lines, plus the ones entering and leaving
+
+// A paragraph word-wrapped into lines that fit a given width. layout() finds
+// the line breaks (spaces, after hyphens, explicit '\n'; words wider than a
+// line are broken mid-word) and aligns each line, once per text: the result
+// is a table of byte ranges and x positions, as long as the text needs.
+// Drawing rasterizes only the lines in view, into a small ring of TextStrips
+// (line i in strip i % TEXT_BLOCK_STRIPS), and blits them; a line stays
+// rasterized until another line takes its strip.
+class TextBlock {
+private:
+    struct Line {
+        uint32_t start;     // Byte offset into text
+        uint16_t length;
+        int16_t x;          // Left edge after alignment
+    };
+
+    char* text;                            // Copy of the laid-out text (owned)
+    Line* lines;                           // lineCapacity entries (owned)
+    uint16_t lineCount;
+    uint16_t lineCapacity;
+    BitmapFont* font;
+    uint16_t fontGeneration;               // The font's generation when the strips were drawn
+    uint8_t lineHeight;                    // Font height plus spacing
+    uint8_t spacing;
+    bool truncated;                        // Out of memory for the line table
+
+    TextStrip strips[TEXT_BLOCK_STRIPS];
+    int32_t stripLine[TEXT_BLOCK_STRIPS];  // Line held by each strip, -1 = none
+
+    // End of the line starting at start: the line is [start, end), the next
+    // one starts at resume
+    static void findBreak(BitmapFont& font, const char* start, uint8_t maxWidth,
+                          const char*& end, const char*& resume);
+
+    // Line i rasterized (from the ring, or into it)
+    const TextStrip& strip(uint16_t i);
+
+public:
+    TextBlock() : text(nullptr), lines(nullptr), lineCount(0), lineCapacity(0), font(nullptr),
+                  fontGeneration(0), lineHeight(0), spacing(1), truncated(false) {
+        for (uint8_t i = 0; i < TEXT_BLOCK_STRIPS; i++) stripLine[i] = -1;
+    }
+    ~TextBlock() {
+        free(text);
+        free(lines);
+    }
+
+    // Wrap UTF-8 text to maxWidth pixels. The text is copied; false if memory
+    // ran out, in which case the lines laid out so far are kept (isTruncated())
+    bool layout(BitmapFont& font, const char* text, uint8_t maxWidth = TOTAL_SIZE,
+                TextAlign align = ALIGN_LEFT, uint8_t lineSpacing = 1);
+
+    uint16_t getLineCount() const { return lineCount; }
+    uint8_t getLineHeight() const { return lineHeight; }
+    int32_t getHeight() const { return lineCount ? (int32_t)lineCount * lineHeight - spacing : 0; }
+    bool isTruncated() const { return truncated; }
+
+    // Draw lines [first, first + count) with the top of line `first` at canvas
+    // row top. Text rows are drawn opaque (glyphs in fg over bg); every other
+    // row of the canvas is filled with bg, so the whole canvas is written once.
+    void render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], int32_t top, CRGB fg, CRGB bg,
+                uint16_t first = 0, uint16_t count = 0xFFFF);
+};
+
+#endif // TEXT_BLOCK_H
@@ -0,0 +1,109 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <Arduino.h>
+#include "render/BitmapFont.h"
+
+enum TextAlign : uint8_t {
+    ALIGN_LEFT,
+    ALIGN_CENTER,
+    ALIGN_RIGHT
+};
+
+// One positioned glyph: x of its bitmap's first column relative to the
+// layout's origin
+struct LayoutGlyph {
+    const FontGlyph* glyph;
+    int32_t x;
+};
+
+// A UTF-8 string decoded once into glyph pointers and pen positions, so text
+// drawn every frame skips decoding, glyph lookup and kerning. set() with the
+// same font and string keeps the existing layout: a hash compare, confirmed
+// against a copy of the laid-out bytes, so a colliding string is laid out anew.
+class TextLayout {
+private:
+    LayoutGlyph* glyphs;
+    char* bytes;           // Copy of the laid-out string (capacity + 1)
+    uint16_t count;
+    uint16_t capacity;
+    BitmapFont* font;
+    uint16_t generation;   // The font's generation when laid out
+    uint32_t hash;
+    uint16_t length;
+    uint16_t width;        // Inked extent
+    int32_t advance;       // Pen position after the last glyph
+
+public:
+    TextLayout() : glyphs(nullptr), bytes(nullptr), count(0), capacity(0), font(nullptr), generation(0), hash(0), length(0), width(0), advance(0) {}
+    ~TextLayout() {
+        free(glyphs);
+        free(bytes);
+    }
+
+    // Lay out text in a font; returns true if it was decoded (new font or
+    // string), false if the cached layout still applies or allocation failed
+    bool set(BitmapFont& newFont, const char* text) {
+        // FNV-1a over the bytes, as BitmapFont's width cache does
+        uint32_t newHash = 2166136261UL;
+        uint16_t newLength = 0;
+        for (const char* p = text; *p; p++, newLength++) newHash = (newHash ^ (uint8_t)*p) * 16777619UL;
+        if (font == &newFont && generation == newFont.getGeneration() && hash == newHash && length == newLength &&
+            memcmp(bytes, text, newLength) == 0) {
+            return false;
+        }
+
+        // A glyph per byte is an upper bound for the decoded length
+        if (newLength > capacity || !bytes) {
+            char* grownBytes = (char*)realloc(bytes, newLength + 1);
+            if (!grownBytes) {
+                clear();
+                return false;
+            }
+            bytes = grownBytes;
+        }
+        if (newLength > capacity) {
+            LayoutGlyph* grown = (LayoutGlyph*)realloc(glyphs, newLength * sizeof(LayoutGlyph));
+            if (!grown) {
+                clear();
+                return false;
+            }
+            glyphs = grown;
+            capacity = newLength;
+        }
+        memcpy(bytes, text, newLength + 1);
+
+        font = &newFont;
+        generation = newFont.getGeneration();
+        hash = newHash;
+        length = newLength;
+        count = 0;
+        width = 0;
+
+        GlyphCursor cursor(text);
+        int32_t left;
+        int32_t right = 0;
+        while (const FontGlyph* g = newFont.nextGlyph(cursor, left)) {
+            glyphs[count++] = {g, left};
+            if (left + g->width > right) right = left + g->width;
+        }
+        width = constrain(right, 0, 0xFFFF);
+        advance = cursor.pen;
+        return true;
+    }
+
+    void clear() {
+        count = 0;
+        font = nullptr;
+        width = 0;
+        advance = 0;
+    }
+
+    BitmapFont* getFont() const { return font; }
+    uint16_t getCount() const { return count; }
+    const LayoutGlyph& operator[](uint16_t i) const { return glyphs[i]; }
+    uint16_t getWidth() const { return width; }
+    int32_t getAdvance() const { return advance; }
+};
+
+#endif // TEXT_LAYOUT_H
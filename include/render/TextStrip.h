@@ -0,0 +1,148 @@
+#ifndef TEXT_STRIP_H
+#define TEXT_STRIP_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/BitmapFont.h"
+#include "render/TextLayout.h"
+
+// A string rasterized once into a packed, column-major strip. 1-bit fonts take
+// one uint32_t per pixel column (bit r = row r); 4-bit anti-aliased fonts take
+// height / 8 words per column (nibble r = coverage of row r). Drawing reads
+// only the columns that land on the canvas, so per-frame cost depends on the
+// canvas width, not on the length of the string.
+class TextStrip {
+private:
+    uint32_t* columns;
+    uint16_t width;        // Columns in use
+    uint32_t capacity;     // Words allocated
+    uint8_t height;
+    uint8_t bpp;
+    uint8_t wordsPerColumn;
+    TextLayout layout;
+
+    // Rows of the strip that fall inside the canvas when drawn at y
+    uint32_t rowMask(int y) const {
+        uint32_t mask = height >= 32 ? 0xFFFFFFFFUL : (1UL << height) - 1;
+        if (y < 0) mask &= y <= -32 ? 0 : 0xFFFFFFFFUL << -y;
+        if (y + height > TOTAL_SIZE) {
+            int visible = TOTAL_SIZE - y;
+            mask &= visible <= 0 ? 0 : (visible >= 32 ? 0xFFFFFFFFUL : (1UL << visible) - 1);
+        }
+        return mask;
+    }
+
+    uint8_t coverageAt(const uint32_t* column, uint8_t row) const {
+        return (column[row >> 3] >> ((row & 7) << 2)) & 0x0F;
+    }
+
+public:
+    TextStrip() : columns(nullptr), width(0), capacity(0), height(0), bpp(1), wordsPerColumn(1) {}
+    ~TextStrip() { free(columns); }
+
+    // Rasterize UTF-8 text in a font; false if the strip can't be allocated
+    bool rasterize(BitmapFont& font, const char* text) {
+        layout.set(font, text);
+        if (layout.getFont() != &font) {
+            width = 0;
+            return false;
+        }
+        height = font.getHeight();
+        bpp = font.getBpp();
+        wordsPerColumn = bpp == 1 ? 1 : (height + 7) >> 3;
+
+        uint16_t needed = layout.getWidth();
+        uint32_t words = (uint32_t)needed * wordsPerColumn;
+        if (words > capacity) {
+            uint32_t* grown = (uint32_t*)realloc(columns, words * sizeof(uint32_t));
+            if (!grown) {
+                width = 0;
+                return false;
+            }
+            columns = grown;
+            capacity = words;
+        }
+        width = needed;
+        memset(columns, 0, words * sizeof(uint32_t));
+
+        for (uint16_t i = 0; i < layout.getCount(); i++) {
+            const FontGlyph* g = layout[i].glyph;
+            const uint8_t* bitmap = font.getGlyphBitmap(g);
+
+            for (uint8_t c = 0; c < g->width; c++) {
+                int x = layout[i].x + c;
+                if (x < 0 || x >= width) continue;
+                uint32_t* column = columns + (uint32_t)x * wordsPerColumn;
+                for (uint8_t r = 0; r < height; r++) {
+                    uint8_t cov = font.coverage(bitmap, c, r);
+                    if (!cov) continue;
+                    if (bpp == 1) {
+                        column[0] |= 1UL << r;
+                    } else if (cov > coverageAt(column, r)) {
+                        uint8_t shift = (r & 7) << 2;
+                        column[r >> 3] = (column[r >> 3] & ~(0x0FUL << shift)) | ((uint32_t)cov << shift);
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    // Rasterize with the built-in 5x7 font
+    bool rasterize(const char* text) { return rasterize(BitmapFont::builtin(), text); }
+
+    uint16_t getWidth() const { return width; }
+    uint8_t getHeight() const { return height; }
+
+    // Draw the strip with its left edge at canvas column x: glyph pixels in fg
+    // (anti-aliased edges blended), everything else in the strip's rows in bg,
+    // so every pixel of the band is written once
+    void render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], int x, int y, CRGB fg, CRGB bg) const {
+        uint32_t mask = rowMask(y);
+        if (!mask) return;
+        for (uint8_t cx = 0; cx < TOTAL_SIZE; cx++) {
+            int sx = cx - x;
+            bool inside = sx >= 0 && sx < width;
+            if (bpp == 1) {
+                uint32_t bits = inside ? columns[sx] : 0;
+                for (uint32_t m = mask; m; m &= m - 1) {
+                    uint8_t r = __builtin_ctz(m);
+                    buffer[y + r][cx] = (bits >> r) & 1 ? fg : bg;
+                }
+            } else {
+                const uint32_t* column = columns + (uint32_t)(inside ? sx : 0) * wordsPerColumn;
+                for (uint32_t m = mask; m; m &= m - 1) {
+                    uint8_t r = __builtin_ctz(m);
+                    uint8_t cov = inside ? coverageAt(column, r) : 0;
+                    buffer[y + r][cx] = cov == 0 ? bg : (cov == 15 ? fg : blend(bg, fg, cov * 17));
+                }
+            }
+        }
+    }
+
+    // Draw only the glyph pixels, leaving the rest of the canvas untouched
+    void blit(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], int x, int y, CRGB fg) const {
+        uint32_t mask = rowMask(y);
+        if (!mask) return;
+        int start = x < 0 ? 0 : x;
+        int end = x + width < TOTAL_SIZE ? x + width : TOTAL_SIZE;
+        for (int cx = start; cx < end; cx++) {
+            if (bpp == 1) {
+                for (uint32_t bits = columns[cx - x] & mask; bits; bits &= bits - 1) {
+                    buffer[y + __builtin_ctz(bits)][cx] = fg;
+                }
+            } else {
+                const uint32_t* column = columns + (uint32_t)(cx - x) * wordsPerColumn;
+                for (uint32_t m = mask; m; m &= m - 1) {
+                    uint8_t r = __builtin_ctz(m);
+                    uint8_t cov = coverageAt(column, r);
+                    if (cov == 15) buffer[y + r][cx] = fg;
+                    else if (cov) nblend(buffer[y + r][cx], fg, cov * 17);
+                }
+            }
+        }
+    }
+};
+
+#endif // TEXT_STRIP_H
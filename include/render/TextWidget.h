@@ -0,0 +1,170 @@
+#ifndef TEXT_WIDGET_H
+#define TEXT_WIDGET_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Animation.h"
+#include "render/BitmapFont.h"
+#include "render/TextLayout.h"
+#include "render/Utf8.h"
+
+#define TEXT_WIDGET_MAX_CELLS 32
+
+// A text field of fixed-pitch glyph cells for values that change a few
+// characters at a time (counters, clocks, sensor readings). set() diffs the
+// new string against the cells' current codepoints; draw() clears and redraws
+// only the cells that changed and reports them as dirty rectangles, so a
+// millisecond counter touches three cells per frame instead of the canvas.
+// Glyphs are centred in their cell and clipped to it, without kerning, so
+// cells never overlap (tabular figures).
+class TextWidget {
+private:
+    BitmapFont* font;
+    int16_t x, y;
+    uint8_t cellWidth;
+    uint8_t requestedWidth;
+    uint8_t cellCount;
+    TextAlign align;
+    CRGB fg, bg;
+    uint16_t cells[TEXT_WIDGET_MAX_CELLS];   // Codepoint per cell (0 = blank)
+    uint32_t pending;                        // Cells to redraw, bit i = cell i
+
+    void drawCell(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint8_t i) {
+        int cellLeft = x + i * cellWidth;
+        int x0 = cellLeft < 0 ? 0 : cellLeft;
+        int x1 = cellLeft + cellWidth < TOTAL_SIZE ? cellLeft + cellWidth : TOTAL_SIZE;
+        int y0 = y < 0 ? 0 : y;
+        int y1 = y + font->getHeight() < TOTAL_SIZE ? y + font->getHeight() : TOTAL_SIZE;
+        for (int py = y0; py < y1; py++) {
+            for (int px = x0; px < x1; px++) buffer[py][px] = bg;
+        }
+        if (!cells[i] || cells[i] == ' ') return;
+
+        const FontGlyph* g = font->findGlyph(cells[i]);
+        if (!g) return;
+        int left = cellLeft + ((int)cellWidth - g->advance) / 2 + g->xOffset;
+        const uint8_t* bitmap = font->getGlyphBitmap(g);
+        for (uint8_t col = 0; col < g->width; col++) {
+            int px = left + col;
+            if (px < x0 || px >= x1) continue;
+            for (int py = y0; py < y1; py++) {
+                uint8_t cov = font->coverage(bitmap, col, py - y);
+                if (cov) buffer[py][px] = cov == 15 ? fg : blend(bg, fg, cov * 17);
+            }
+        }
+    }
+
+    static void addRect(DirtyRect* rects, uint8_t& count, uint8_t maxRects, const DirtyRect& r) {
+        if (count < maxRects) {
+            rects[count++] = r;
+            return;
+        }
+        if (count == 0) return;
+        // Out of slots: grow the last rect to cover this one too
+        DirtyRect& last = rects[count - 1];
+        int x0 = last.x < r.x ? last.x : r.x;
+        int y0 = last.y < r.y ? last.y : r.y;
+        int x1 = last.x + last.w > r.x + r.w ? last.x + last.w : r.x + r.w;
+        int y1 = last.y + last.h > r.y + r.h ? last.y + last.h : r.y + r.h;
+        last = {(uint8_t)x0, (uint8_t)y0, (uint8_t)(x1 - x0), (uint8_t)(y1 - y0)};
+    }
+
+public:
+    // Cells are at least as wide as the widest digit, so numbers don't jitter
+    TextWidget(uint8_t cells = 8, uint8_t width = 0, TextAlign textAlign = ALIGN_LEFT)
+        : font(nullptr), x(0), y(0), cellWidth(width), requestedWidth(width),
+          cellCount(cells > TEXT_WIDGET_MAX_CELLS ? TEXT_WIDGET_MAX_CELLS : cells),
+          align(textAlign), fg(CRGB::White), bg(CRGB::Black), pending(0) {
+        memset(this->cells, 0, sizeof(this->cells));
+        setFont(&BitmapFont::builtin());
+    }
+
+    void setFont(BitmapFont* newFont) {
+        font = newFont && newFont->isValid() ? newFont : &BitmapFont::builtin();
+        uint8_t width = 0;
+        for (char c = '0'; c <= '9'; c++) {
+            const FontGlyph* g = font->findGlyph(c);
+            if (g && g->advance > width) width = g->advance;
+        }
+        cellWidth = requestedWidth > width ? requestedWidth : width;
+        invalidate();
+    }
+
+    void setPosition(int16_t newX, int16_t newY) {
+        x = newX;
+        y = newY;
+        invalidate();
+    }
+
+    void setColors(CRGB textColor, CRGB background) {
+        fg = textColor;
+        bg = background;
+        invalidate();
+    }
+
+    // Decode UTF-8 text into the cells (aligned within the field, extra
+    // characters dropped); returns true if any cell changed
+    bool set(const char* text) {
+        uint16_t next[TEXT_WIDGET_MAX_CELLS];
+        uint8_t n = 0;
+        for (const char* p = text; *p && n < cellCount;) {
+            uint32_t cp = utf8Next(p);
+            next[n++] = cp > 0xFFFF ? UTF8_REPLACEMENT : cp;
+        }
+
+        uint8_t start = align == ALIGN_RIGHT ? cellCount - n : (align == ALIGN_CENTER ? (cellCount - n) / 2 : 0);
+        uint32_t changed = 0;
+        for (uint8_t i = 0; i < cellCount; i++) {
+            uint16_t cp = i >= start && i < start + n ? next[i - start] : 0;
+            if (cp != cells[i]) {
+                cells[i] = cp;
+                changed |= 1UL << i;
+            }
+        }
+        pending |= changed;
+        return changed != 0;
+    }
+
+    // Redraw every cell on the next draw()
+    void invalidate() { pending = cellCount >= 32 ? 0xFFFFFFFFUL : (1UL << cellCount) - 1; }
+
+    bool isPending() const { return pending != 0; }
+    uint8_t getCellWidth() const { return cellWidth; }
+    uint16_t getWidth() const { return cellCount * cellWidth; }
+    uint8_t getHeight() const { return font->getHeight(); }
+
+    // Redraw the changed cells; runs of adjacent cells are appended to rects
+    // as one rectangle each. Returns the new rect count.
+    uint8_t draw(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], DirtyRect* rects, uint8_t count, uint8_t maxRects) {
+        uint8_t i = 0;
+        while (pending && i < cellCount) {
+            if (!((pending >> i) & 1)) {
+                i++;
+                continue;
+            }
+            uint8_t runStart = i;
+            while (i < cellCount && ((pending >> i) & 1)) {
+                drawCell(buffer, i);
+                pending &= ~(1UL << i);
+                i++;
+            }
+
+            // Clip the run to the canvas
+            int left = x + runStart * cellWidth;
+            int right = x + i * cellWidth;
+            int top = y;
+            int bottom = y + font->getHeight();
+            if (left < 0) left = 0;
+            if (top < 0) top = 0;
+            if (right > TOTAL_SIZE) right = TOTAL_SIZE;
+            if (bottom > TOTAL_SIZE) bottom = TOTAL_SIZE;
+            if (left < right && top < bottom) {
+                addRect(rects, count, maxRects, {(uint8_t)left, (uint8_t)top, (uint8_t)(right - left), (uint8_t)(bottom - top)});
+            }
+        }
+        pending = 0;
+        return count;
+    }
+};
+
+#endif // TEXT_WIDGET_H
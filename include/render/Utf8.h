@@ -0,0 +1,34 @@
+#ifndef UTF8_H
+#define UTF8_H
+
+#include <Arduino.h>
+
+#define UTF8_REPLACEMENT 0xFFFD
+
+// Decode the UTF-8 sequence at p and advance p past it. Malformed input
+// (stray continuation bytes, truncated or overlong sequences, surrogates)
+// yields U+FFFD and consumes one byte, so decoding always makes progress and
+// never reads past the terminating NUL.
+inline uint32_t utf8Next(const char*& p) {
+    uint8_t lead = (uint8_t)*p++;
+    if (lead < 0x80) return lead;
+
+    uint8_t extra;
+    uint32_t cp;
+    uint32_t minimum;
+    if ((lead & 0xE0) == 0xC0) { extra = 1; cp = lead & 0x1F; minimum = 0x80; }
+    else if ((lead & 0xF0) == 0xE0) { extra = 2; cp = lead & 0x0F; minimum = 0x800; }
+    else if ((lead & 0xF8) == 0xF0) { extra = 3; cp = lead & 0x07; minimum = 0x10000; }
+    else return UTF8_REPLACEMENT;
+
+    for (uint8_t i = 0; i < extra; i++) {
+        uint8_t b = (uint8_t)p[i];
+        if ((b & 0xC0) != 0x80) return UTF8_REPLACEMENT;
+        cp = (cp << 6) | (b & 0x3F);
+    }
+    if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return UTF8_REPLACEMENT;
+    p += extra;
+    return cp;
+}
+
+#endif // UTF8_H
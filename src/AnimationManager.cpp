@@ -1,16 +1,86 @@
 #include "AnimationManager.h"
 
 AnimationManager::AnimationManager(MatrixOrientation* matrixPtr)
-    : animationCount(0), currentIndex(-1), lastSwitchMs(0), autoCycleMs(0), matrix(matrixPtr) {
+    : animationCount(0), currentIndex(-1), lastSwitchMs(0), autoCycleMs(0), matrix(matrixPtr),
+      bandFrameTime(0), fullRemapNeeded(true) {
     for (uint8_t i = 0; i < MAX_ANIMATIONS; i++) {
         animations[i] = nullptr;
+        renderDivisor[i] = 1;
+        upscaleFilter[i] = UPSCALE_NEAREST;
+        postCount[i] = 0;
     }
+    memset(&stats, 0, sizeof(stats));
 }
 
 void AnimationManager::setAutoCycle(uint32_t intervalMs) {
     autoCycleMs = intervalMs;
 }
 
+bool AnimationManager::setRenderBands(uint8_t bands) {
+    if (bands <= 1) {
+        renderPool.end();
+        return true;
+    }
+    return renderPool.begin(bands);
+}
+
+bool AnimationManager::setRenderScale(const char* name, uint8_t divisor, UpscaleFilter filter) {
+    if (divisor != 1 && divisor != 2 && divisor != 4 && divisor != 8) return false;
+
+    bool found = false;
+    for (uint8_t i = 0; i < animationCount; i++) {
+        if (strcmp(animations[i]->getName(), name) == 0) {
+            renderDivisor[i] = divisor;
+            upscaleFilter[i] = filter;
+            found = true;
+            fullRemapNeeded = true;
+        }
+    }
+    return found;
+}
+
+bool AnimationManager::setPostChain(const char* name, const PostPass* passes, uint8_t count) {
+    if (count > MAX_POST_PASSES) count = MAX_POST_PASSES;
+
+    bool found = false;
+    for (uint8_t i = 0; i < animationCount; i++) {
+        if (strcmp(animations[i]->getName(), name) == 0) {
+            memcpy(postPasses[i], passes, count * sizeof(PostPass));
+            postCount[i] = count;
+            found = true;
+            fullRemapNeeded = true;
+        }
+    }
+    return found;
+}
+
+uint8_t AnimationManager::getRenderBands() const { return renderPool.getBandCount(); }
+
+void AnimationManager::renderBandThunk(void* ctx, uint8_t yStart, uint8_t yEnd) {
+    AnimationManager* self = static_cast<AnimationManager*>(ctx);
+    self->animations[self->currentIndex]->renderBand(self->frameBuffer, self->bandFrameTime, yStart, yEnd);
+}
+
+void AnimationManager::expandSymmetry(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], RenderSymmetry symmetry) {
+    const uint8_t half = TOTAL_SIZE / 2;
+    if (symmetry & FOLD_DIAGONAL) {
+        for (uint8_t y = 1; y < half; y++) {
+            for (uint8_t x = 0; x < y; x++) buffer[y][x] = buffer[x][y];
+        }
+    }
+    uint8_t rows = (symmetry & SYMMETRY_VERTICAL) ? half : TOTAL_SIZE;
+    if (symmetry & SYMMETRY_HORIZONTAL) {
+        for (uint8_t y = 0; y < rows; y++) {
+            for (uint8_t x = 0; x < half; x++) buffer[y][TOTAL_SIZE - 1 - x] = buffer[y][x];
+        }
+    }
+    if (symmetry & SYMMETRY_VERTICAL) {
+        for (uint8_t y = 0; y < half; y++) {
+            memcpy(buffer[TOTAL_SIZE - 1 - y], buffer[y], sizeof(buffer[y]));
+        }
+    }
+}
+
 bool AnimationManager::registerAnimation(Animation* animation) {
     if (animationCount >= MAX_ANIMATIONS) return false;
     animations[animationCount++] = animation;
@@ -23,7 +93,9 @@ bool AnimationManager::switchTo(uint8_t index) {
     if (index >= animationCount) return false;
     currentIndex = index;
     animations[currentIndex]->setup();
+    post.reset();
     lastSwitchMs = millis();
+    fullRemapNeeded = true;
     return true;
 }
 
@@ -43,6 +115,17 @@ const char* AnimationManager::getCurrentName() const {
     return animations[currentIndex]->getName();
 }
 
+uint8_t AnimationManager::getCurrentPostChain(const PostPass*& passes) const {
+    if (currentIndex < 0 || currentIndex >= animationCount) return 0;
+    passes = postPasses[currentIndex];
+    return postCount[currentIndex];
+}
+
+Animation* AnimationManager::getCurrentAnimation() const {
+    if (currentIndex < 0 || currentIndex >= animationCount) return nullptr;
+    return animations[currentIndex];
+}
+
 void AnimationManager::setup() {
     if (animationCount > 0 && currentIndex < 0) {
         uint8_t firstIndex = 0;
@@ -50,8 +133,8 @@ void AnimationManager::setup() {
     }
 }
 
-void AnimationManager::loop(CRGB* leds) {
-    if (animationCount == 0 || currentIndex < 0 || !matrix) return;
+bool AnimationManager::loop(CRGB* leds) {
+    if (animationCount == 0 || currentIndex < 0 || !matrix) return false;
 
     // Auto cycle if enabled
     if (autoCycleMs > 0) {
@@ -62,11 +145,86 @@ void AnimationManager::loop(CRGB* leds) {
         }
     }
 
-    // Render animation into 2D frame buffer
-    animations[currentIndex]->renderFrame(frameBuffer, millis());
+    Animation* anim = animations[currentIndex];
+    uint32_t t0 = micros();
 
-    // Transform 2D logical coordinates to physical LED indices
-    matrix->render(frameBuffer, leds);
-}
+    // Physical path: frames already in LED order go straight to the LEDs
+    if (renderDivisor[currentIndex] == 1 && postCount[currentIndex] == 0 && anim->isPhysical()) {
+        bool changed = anim->renderPhysical(leds, millis(), fullRemapNeeded);
+        fullRemapNeeded = false;
+        stats.renderUs = micros() - t0;
+        stats.postUs = 0;
+        for (uint8_t i = 0; i < MAX_POST_PASSES; i++) stats.postPassUs[i] = 0;
+        stats.remapUs = 0;
+        stats.remapPixels = 0;
+        stats.frames++;
+        return changed;
+    }
+
+    // Reduced-resolution path: render a small canvas and upscale it while remapping
+    uint8_t divisor = renderDivisor[currentIndex];
+    uint8_t scaledSize = TOTAL_SIZE / divisor;
+    bool scaled = divisor > 1 && anim->renderScaled(frameBuffer, millis(), scaledSize, scaledSize);
 
+    // Symmetric path: render the fundamental region and let the remap mirror it
+    RenderSymmetry symmetry = scaled ? SYMMETRY_NONE : anim->getSymmetry();
 
+    if (!scaled) {
+        // Render animation into 2D frame buffer, split across cores when it is safe to
+        if (symmetry != SYMMETRY_NONE) {
+            uint8_t width = (symmetry & SYMMETRY_HORIZONTAL) ? TOTAL_SIZE / 2 : TOTAL_SIZE;
+            uint8_t height = (symmetry & SYMMETRY_VERTICAL) ? TOTAL_SIZE / 2 : TOTAL_SIZE;
+            anim->renderSymmetric(frameBuffer, millis(), width, height);
+            // Post passes need the whole canvas
+            if (postCount[currentIndex] > 0) {
+                expandSymmetry(frameBuffer, symmetry);
+                symmetry = SYMMETRY_NONE;
+            }
+        } else if (renderPool.getBandCount() > 1 && anim->isBandParallelSafe()) {
+            bandFrameTime = millis();
+            renderPool.run(renderBandThunk, this, TOTAL_SIZE);
+        } else {
+            anim->renderFrame(frameBuffer, millis());
+        }
+    }
+    uint32_t t1 = micros();
+
+    // Post-process into a separate buffer; frameBuffer keeps the animation's own output
+    uint8_t size = scaled ? scaledSize : TOTAL_SIZE;
+    CRGB (*out)[TOTAL_SIZE] = post.apply(frameBuffer, postPasses[currentIndex], postCount[currentIndex], size, size);
+    uint32_t t2 = micros();
+
+    // Partial update: only the plain path keeps canvas and LEDs pixel for pixel in step
+    DirtyRect dirty[MAX_DIRTY_RECTS];
+    uint8_t dirtyCount = DIRTY_FULL_FRAME;
+    if (!scaled && symmetry == SYMMETRY_NONE && postCount[currentIndex] == 0 && !fullRemapNeeded) {
+        dirtyCount = anim->getDirtyRects(dirty, MAX_DIRTY_RECTS);
+        if (dirtyCount > MAX_DIRTY_RECTS) dirtyCount = DIRTY_FULL_FRAME;
+    }
+
+    // Transform 2D logical coordinates to physical LED indices
+    uint16_t remapPixels = TOTAL_SIZE * TOTAL_SIZE;
+    if (dirtyCount != DIRTY_FULL_FRAME) {
+        remapPixels = 0;
+        for (uint8_t i = 0; i < dirtyCount; i++) {
+            matrix->renderRect(out, dirty[i].x, dirty[i].y, dirty[i].w, dirty[i].h, leds);
+            remapPixels += dirty[i].w * dirty[i].h;
+        }
+    } else if (scaled) {
+        matrix->renderUpscaled(out, scaledSize, scaledSize, leds, upscaleFilter[currentIndex]);
+    } else if (symmetry != SYMMETRY_NONE) {
+        matrix->renderFolded(out, symmetry, leds);
+    } else {
+        matrix->render(out, leds);
+    }
+    if (dirtyCount == DIRTY_FULL_FRAME) fullRemapNeeded = false;
+    uint32_t t3 = micros();
+
+    stats.renderUs = t1 - t0;
+    stats.postUs = t2 - t1;
+    for (uint8_t i = 0; i < MAX_POST_PASSES; i++) stats.postPassUs[i] = post.getPassUs(i);
+    stats.remapUs = t3 - t2;
+    stats.remapPixels = remapPixels;
+    stats.frames++;
+    return dirtyCount != 0;
+}
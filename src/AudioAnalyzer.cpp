@@ -0,0 +1,207 @@
+#include "audio/AudioAnalyzer.h"
+#include <math.h>
+#include <string.h>
+
+// Band levels cover 8 octaves (~48 dB) below the running peak
+#define AUDIO_RANGE_Q4 (8 * 16)
+// Per-block fall of a band after its peak (attack is instant)
+#define AUDIO_BAND_DECAY 10
+// Bands summed for beat detection (roughly 40-200 Hz at 22.05 kHz)
+#define AUDIO_BEAT_BANDS 4
+
+AudioAnalyzer::AudioAnalyzer(IAudioSource* audioSource)
+    : source(audioSource), peakLog(0), bassAverage(0), blocksSinceBeat(0), minBeatBlocks(1),
+      beatCount(0), blocks(0), publishSeq(0), processUs(0), hopUs(0), stopping(false), running(false)
+#if defined(ARDUINO)
+    , task(nullptr), doneSem(nullptr)
+#endif
+{
+    memset(samples, 0, sizeof(samples));
+    memset(smoothed, 0, sizeof(smoothed));
+    memset(&published, 0, sizeof(published));
+
+    // Log-spaced band edges from bin 1 (DC skipped) to Nyquist, at least one bin each
+    bandEdge[0] = 1;
+    for (uint8_t b = 1; b <= AUDIO_BANDS; b++) {
+        uint16_t edge = (uint16_t)lround(pow((double)AUDIO_FFT_BINS, (double)b / AUDIO_BANDS));
+        if (edge <= bandEdge[b - 1]) edge = bandEdge[b - 1] + 1;
+        bandEdge[b] = edge > AUDIO_FFT_BINS ? AUDIO_FFT_BINS : edge;
+    }
+}
+
+AudioAnalyzer::~AudioAnalyzer() {
+    end();
+}
+
+// floor(log2(v)) in the high bits, the next four mantissa bits below
+uint16_t AudioAnalyzer::log2Q4(uint32_t v) {
+    if (v == 0) return 0;
+    uint8_t bit = 31;
+    while (!(v & (1UL << bit))) bit--;
+    uint8_t frac = bit >= 4 ? (v >> (bit - 4)) & 0x0F : (v << (4 - bit)) & 0x0F;
+    return (bit << 4) | frac;
+}
+
+void AudioAnalyzer::process(const int16_t* hop, uint32_t captureUs, AudioSnapshot& out) {
+    memmove(samples, samples + AUDIO_HOP, (AUDIO_FFT_SIZE - AUDIO_HOP) * sizeof(int16_t));
+    memcpy(samples + AUDIO_FFT_SIZE - AUDIO_HOP, hop, AUDIO_HOP * sizeof(int16_t));
+
+    fft.load(samples, re, im);
+    fft.transform(re, im);
+    FixedFFT::magnitudes(re, im, magnitude);
+
+    // Band sums and their logs; the loudest band drives the auto-gain
+    uint32_t sums[AUDIO_BANDS];
+    uint16_t logs[AUDIO_BANDS];
+    uint16_t loudest = 0;
+    for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+        uint32_t sum = 0;
+        for (uint16_t k = bandEdge[b]; k < bandEdge[b + 1]; k++) sum += magnitude[k];
+        sums[b] = sum;
+        logs[b] = log2Q4(sum);
+        if (logs[b] > loudest) loudest = logs[b];
+    }
+
+    // Peak follows loud passages at once and relaxes by 1/16 octave per block
+    if (loudest > peakLog) peakLog = loudest;
+    else if (peakLog > AUDIO_RANGE_Q4 / 2) peakLog--;
+
+    uint16_t floorLog = peakLog > AUDIO_RANGE_Q4 ? peakLog - AUDIO_RANGE_Q4 : 0;
+    for (uint8_t b = 0; b < AUDIO_BANDS; b++) {
+        uint16_t level = logs[b] > floorLog ? ((uint32_t)(logs[b] - floorLog) * 255) / AUDIO_RANGE_Q4 : 0;
+        if (level > 255) level = 255;
+        uint8_t held = smoothed[b] > AUDIO_BAND_DECAY ? smoothed[b] - AUDIO_BAND_DECAY : 0;
+        smoothed[b] = level > held ? level : held;
+        out.bands[b] = smoothed[b];
+    }
+
+    // Loudness from mean absolute amplitude of the new samples (15 octaves -> 0..255)
+    uint32_t absSum = 0;
+    for (uint16_t i = 0; i < AUDIO_HOP; i++) absSum += hop[i] < 0 ? -hop[i] : hop[i];
+    uint32_t loud = ((uint32_t)log2Q4(absSum / AUDIO_HOP) * 255) / (15 * 16);
+    out.level = loud > 255 ? 255 : loud;
+
+    // Beat: low-band energy jumps 1.5x above its running average
+    uint32_t bass = 0;
+    for (uint8_t b = 0; b < AUDIO_BEAT_BANDS; b++) bass += sums[b];
+    blocksSinceBeat++;
+    out.beat = false;
+    if (bass * 2 > bassAverage * 3 && bass > 64 && blocksSinceBeat >= minBeatBlocks) {
+        out.beat = true;
+        beatCount++;
+        blocksSinceBeat = 0;
+    }
+    bassAverage = bassAverage - (bassAverage >> 4) + (bass >> 4);
+
+    out.beatCount = beatCount;
+    out.captureUs = captureUs;
+    out.sequence = ++blocks;
+}
+
+void AudioAnalyzer::publish(const AudioSnapshot& snap) {
+    uint32_t seq = publishSeq.load(std::memory_order_relaxed);
+    publishSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    published = snap;
+    publishSeq.store(seq + 2, std::memory_order_release);
+}
+
+bool AudioAnalyzer::read(AudioSnapshot& out) const {
+    // The writer publishes once per ~12 ms block, so a retry is rare and short
+    for (;;) {
+        uint32_t before = publishSeq.load(std::memory_order_acquire);
+        if (before & 1) continue;
+        out = published;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (publishSeq.load(std::memory_order_relaxed) == before) return before != 0;
+    }
+}
+
+// Collect exactly count samples from the source; false once it has ended
+bool AudioAnalyzer::fill(int16_t* dst, uint16_t count) {
+    uint16_t got = 0;
+    while (got < count) {
+        if (stopping) return false;
+        size_t n = source->read(dst + got, count - got);
+        if (n == 0) return false;
+        got += n;
+    }
+    return true;
+}
+
+void AudioAnalyzer::run() {
+    int16_t hop[AUDIO_HOP];
+    AudioSnapshot snap;
+    memset(&snap, 0, sizeof(snap));
+
+    while (!stopping && fill(hop, AUDIO_HOP)) {
+        uint32_t captured = audioMicros();
+        process(hop, captured, snap);
+        publish(snap);
+        processUs = audioMicros() - captured;
+    }
+    running = false;
+}
+
+void AudioAnalyzer::setSampleRate(uint32_t rate) {
+    hopUs = (uint32_t)((uint64_t)AUDIO_HOP * 1000000 / rate);
+    minBeatBlocks = (AUDIO_MIN_BEAT_MS * 1000 + hopUs - 1) / hopUs;
+}
+
+bool AudioAnalyzer::begin() {
+    end();
+    if (!source || !source->begin()) return false;
+
+    uint32_t rate = source->getSampleRate();
+    setSampleRate(rate);
+    stopping = false;
+    running = true;
+
+#if defined(ARDUINO)
+    doneSem = xSemaphoreCreateBinary();
+    if (!doneSem) {
+        running = false;
+        return false;
+    }
+    // The render loop runs on core 1; keep the audio work on the other core
+    if (xTaskCreatePinnedToCore(audioTask, "audio", 6144, this, 3, &task, 0) != pdPASS) {
+        Serial.println("✗ Failed to start audio task");
+        vSemaphoreDelete(doneSem);
+        doneSem = nullptr;
+        running = false;
+        return false;
+    }
+    Serial.printf("✓ Audio analyzer: %lu Hz, %d-point FFT, %d bands\n",
+                  (unsigned long)rate, AUDIO_FFT_SIZE, AUDIO_BANDS);
+#else
+    thread = std::thread([this] { run(); });
+#endif
+    return true;
+}
+
+#if defined(ARDUINO)
+
+void AudioAnalyzer::audioTask(void* param) {
+    AudioAnalyzer* analyzer = static_cast<AudioAnalyzer*>(param);
+    analyzer->run();
+    xSemaphoreGive(analyzer->doneSem);
+    vTaskDelete(nullptr);
+}
+
+void AudioAnalyzer::end() {
+    if (!doneSem) return;
+    stopping = true;
+    xSemaphoreTake(doneSem, portMAX_DELAY);
+    vSemaphoreDelete(doneSem);
+    doneSem = nullptr;
+    task = nullptr;
+}
+
+#else
+
+void AudioAnalyzer::end() {
+    stopping = true;
+    if (thread.joinable()) thread.join();
+}
+
+#endif
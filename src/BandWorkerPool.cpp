@@ -0,0 +1,181 @@
+#include "render/BandWorkerPool.h"
+
+BandWorkerPool::BandWorkerPool()
+    : bandCount(1), stopping(false), jobFn(nullptr), jobCtx(nullptr), jobRows(0)
+#if defined(ARDUINO)
+    , doneSem(nullptr)
+#else
+    , generation(0), pending(0)
+#endif
+{
+    for (uint8_t i = 0; i < MAX_RENDER_BANDS - 1; i++) {
+        workers[i].pool = this;
+        workers[i].band = i + 1;
+#if defined(ARDUINO)
+        workers[i].task = nullptr;
+#endif
+    }
+}
+
+BandWorkerPool::~BandWorkerPool() {
+    end();
+}
+
+void BandWorkerPool::runBand(uint8_t band) {
+    uint8_t yStart = (uint16_t)jobRows * band / bandCount;
+    uint8_t yEnd = (uint16_t)jobRows * (band + 1) / bandCount;
+    if (yEnd > yStart) {
+        jobFn(jobCtx, yStart, yEnd);
+    }
+}
+
+#if defined(ARDUINO)
+
+void BandWorkerPool::workerTask(void* param) {
+    Worker* worker = static_cast<Worker*>(param);
+    BandWorkerPool* pool = worker->pool;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (pool->stopping) break;
+        pool->runBand(worker->band);
+        xSemaphoreGive(pool->doneSem);
+    }
+
+    // Signal end() that this worker has left the loop
+    xSemaphoreGive(pool->doneSem);
+    vTaskDelete(nullptr);
+}
+
+bool BandWorkerPool::begin(uint8_t bands) {
+    end();
+    if (bands < 1) bands = 1;
+    if (bands > MAX_RENDER_BANDS) bands = MAX_RENDER_BANDS;
+
+    doneSem = xSemaphoreCreateCounting(MAX_RENDER_BANDS, 0);
+    if (!doneSem) return false;
+
+    stopping = false;
+    bandCount = 1;
+    int callerCore = xPortGetCoreID();
+
+    for (uint8_t i = 0; i + 1 < bands; i++) {
+        // Spread workers over the cores the caller is not running on
+        int core = (callerCore + 1 + i) % portNUM_PROCESSORS;
+        BaseType_t ok = xTaskCreatePinnedToCore(workerTask, "bandWorker", 4096, &workers[i],
+                                                2, &workers[i].task, core);
+        if (ok != pdPASS) {
+            workers[i].task = nullptr;
+            Serial.printf("✗ Failed to start band worker %d\n", i + 1);
+            break;
+        }
+        bandCount++;
+    }
+
+    Serial.printf("Band worker pool: %d band(s)\n", bandCount);
+    return bandCount == bands;
+}
+
+void BandWorkerPool::end() {
+    if (!doneSem) return;
+
+    stopping = true;
+    uint8_t running = bandCount - 1;
+    for (uint8_t i = 0; i < running; i++) {
+        xTaskNotifyGive(workers[i].task);
+    }
+    for (uint8_t i = 0; i < running; i++) {
+        xSemaphoreTake(doneSem, portMAX_DELAY);
+        workers[i].task = nullptr;
+    }
+
+    vSemaphoreDelete(doneSem);
+    doneSem = nullptr;
+    bandCount = 1;
+}
+
+void BandWorkerPool::run(BandFn fn, void* ctx, uint8_t rows) {
+    jobFn = fn;
+    jobCtx = ctx;
+    jobRows = rows;
+
+    // Release the workers, render our own band, then wait at the barrier
+    for (uint8_t i = 0; i + 1 < bandCount; i++) {
+        xTaskNotifyGive(workers[i].task);
+    }
+    runBand(0);
+    for (uint8_t i = 0; i + 1 < bandCount; i++) {
+        xSemaphoreTake(doneSem, portMAX_DELAY);
+    }
+}
+
+#else // host build: std::thread workers
+
+void BandWorkerPool::workerThread(Worker* worker) {
+    BandWorkerPool* pool = worker->pool;
+    uint32_t seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(pool->mutex);
+            pool->startCv.wait(lock, [&] { return pool->stopping || pool->generation != seen; });
+            if (pool->stopping) return;
+            seen = pool->generation;
+        }
+        pool->runBand(worker->band);
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (--pool->pending == 0) pool->doneCv.notify_one();
+        }
+    }
+}
+
+bool BandWorkerPool::begin(uint8_t bands) {
+    end();
+    if (bands < 1) bands = 1;
+    if (bands > MAX_RENDER_BANDS) bands = MAX_RENDER_BANDS;
+
+    {
+        // The previous workers are joined: start the new ones from a clean
+        // generation, or they would re-run the last job on waking
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = false;
+        generation = 0;
+        pending = 0;
+    }
+    bandCount = bands;
+    for (uint8_t i = 0; i + 1 < bands; i++) {
+        workers[i].thread = std::thread(workerThread, &workers[i]);
+    }
+    return true;
+}
+
+void BandWorkerPool::end() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    startCv.notify_all();
+    for (uint8_t i = 0; i + 1 < bandCount; i++) {
+        if (workers[i].thread.joinable()) workers[i].thread.join();
+    }
+    bandCount = 1;
+}
+
+void BandWorkerPool::run(BandFn fn, void* ctx, uint8_t rows) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobFn = fn;
+        jobCtx = ctx;
+        jobRows = rows;
+        pending = bandCount - 1;
+        generation++;
+    }
+    startCv.notify_all();
+    runBand(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    doneCv.wait(lock, [&] { return pending == 0; });
+}
+
+#endif
@@ -0,0 +1,245 @@
+#include "render/BitmapFont.h"
+#include "TextRenderer.h"
+#include "render/Utf8.h"
+
+BitmapFont::BitmapFont()
+    : glyphs(nullptr), kerning(nullptr), bitmaps(nullptr), tables(nullptr),
+      bitmapStart(0), columnBytes(1), fallback(nullptr), generation(0),
+      useClock(0), cacheHits(0), cacheMisses(0), nextWidth(0) {
+    memset(&header, 0, sizeof(header));
+    resetCaches();
+}
+
+void BitmapFont::resetCaches() {
+    for (uint8_t i = 0; i < FONT_CACHE_SLOTS; i++) {
+        cache[i].glyph = nullptr;
+        cache[i].lastUse = 0;
+    }
+    memset(widths, 0, sizeof(widths));
+    nextWidth = 0;
+}
+
+void BitmapFont::release() {
+    if (file) file.close();
+    free(tables);
+    tables = nullptr;
+    glyphs = nullptr;
+    kerning = nullptr;
+    bitmaps = nullptr;
+    fallback = nullptr;
+    generation++;
+    memset(&header, 0, sizeof(header));
+    resetCaches();
+}
+
+// Check the header and tables; data holds at least the header and both tables
+bool BitmapFont::parse(const uint8_t* data, size_t size) {
+    memcpy(&header, data, sizeof(header));
+    if (strncmp(header.magic, "FNT1", 4) != 0) return false;
+    if (header.height == 0 || header.height > 32 || (header.bpp != 1 && header.bpp != 4)) return false;
+    if (header.glyphCount == 0) return false;
+
+    size_t tablesEnd = sizeof(FontHeader) + (size_t)header.glyphCount * sizeof(FontGlyph) +
+                       (size_t)header.kernCount * sizeof(FontKern);
+    if (tablesEnd > size) return false;
+
+    glyphs = (const FontGlyph*)(data + sizeof(FontHeader));
+    kerning = (const FontKern*)(glyphs + header.glyphCount);
+    columnBytes = (header.height * header.bpp + 7) >> 3;
+
+    for (uint16_t i = 1; i < header.glyphCount; i++) {
+        if (glyphs[i].codepoint <= glyphs[i - 1].codepoint) return false;
+    }
+    fallback = nullptr;
+    fallback = findGlyph(header.defaultCodepoint);
+    if (!fallback) fallback = &glyphs[0];
+    return true;
+}
+
+bool BitmapFont::load(const char* path) {
+    release();
+
+    file = LittleFS.open(path, "r");
+    if (!file) {
+        Serial.printf("✗ Font not found: %s\n", path);
+        return false;
+    }
+
+    FontHeader h;
+    if (file.read((uint8_t*)&h, sizeof(h)) != sizeof(h)) {
+        Serial.printf("✗ Font too small: %s\n", path);
+        release();
+        return false;
+    }
+
+    size_t tablesSize = sizeof(FontHeader) + (size_t)h.glyphCount * sizeof(FontGlyph) +
+                        (size_t)h.kernCount * sizeof(FontKern);
+    tables = (uint8_t*)malloc(tablesSize);
+    if (!tables) {
+        Serial.printf("✗ Out of memory loading font: %s\n", path);
+        release();
+        return false;
+    }
+    memcpy(tables, &h, sizeof(h));
+    size_t rest = tablesSize - sizeof(h);
+    if (file.read(tables + sizeof(h), rest) != rest || !parse(tables, tablesSize)) {
+        Serial.printf("✗ Invalid font: %s\n", path);
+        release();
+        return false;
+    }
+
+    // Every glyph bitmap must lie inside the file and fit a cache slot
+    bitmapStart = tablesSize;
+    size_t bitmapSize = file.size() - tablesSize;
+    for (uint16_t i = 0; i < header.glyphCount; i++) {
+        size_t bytes = (size_t)glyphs[i].width * columnBytes;
+        if (glyphs[i].offset + bytes > bitmapSize || bytes > FONT_CACHE_SLOT_BYTES) {
+            Serial.printf("✗ Invalid font (glyph %u out of range or too large): %s\n", glyphs[i].codepoint, path);
+            release();
+            return false;
+        }
+    }
+
+    Serial.printf("✓ Font loaded: %s (%u glyphs, %u px, %u bpp, %u kerning pairs)\n", path,
+                  header.glyphCount, header.height, header.bpp, header.kernCount);
+    return true;
+}
+
+bool BitmapFont::loadFromMemory(const uint8_t* data, size_t size) {
+    release();
+    if (size < sizeof(FontHeader) || !parse(data, size)) {
+        release();
+        return false;
+    }
+    bitmaps = (const uint8_t*)(kerning + header.kernCount);
+    size_t bitmapSize = size - (bitmaps - data);
+    for (uint16_t i = 0; i < header.glyphCount; i++) {
+        if (glyphs[i].offset + (size_t)glyphs[i].width * columnBytes > bitmapSize) {
+            release();
+            return false;
+        }
+    }
+    return true;
+}
+
+BitmapFont& BitmapFont::builtin() {
+    static BitmapFont font;
+    if (font.isValid()) return font;
+
+    // TextRenderer's 5x7 font already is a 1-bit column-major bitmap (one byte
+    // per column); its glyphs are stored in codepoint order
+    const uint16_t count = TextRenderer::getGlyphCount();
+    size_t tablesSize = sizeof(FontHeader) + count * sizeof(FontGlyph);
+    font.tables = (uint8_t*)malloc(tablesSize);
+    if (!font.tables) return font;
+
+    FontHeader h = {{'F', 'N', 'T', '1'}, FONT_HEIGHT, FONT_HEIGHT, 1, 0, count, 0, ' ', 0};
+    memcpy(font.tables, &h, sizeof(h));
+    FontGlyph* g = (FontGlyph*)(font.tables + sizeof(FontHeader));
+    for (uint16_t i = 0; i < count; i++) {
+        g[i].codepoint = TextRenderer::getGlyphCodepoint(i);
+        g[i].width = FONT_WIDTH;
+        g[i].advance = FONT_WIDTH + FONT_SPACING;
+        g[i].xOffset = 0;
+        g[i].reserved = 0;
+        g[i].offset = i * FONT_WIDTH;
+    }
+    font.parse(font.tables, tablesSize);
+    font.bitmaps = TextRenderer::getGlyphData(0);
+    return font;
+}
+
+const FontGlyph* BitmapFont::findGlyph(uint32_t codepoint) const {
+    if (codepoint > 0xFFFF) return fallback;
+    uint16_t lo = 0, hi = header.glyphCount;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) >> 1;
+        if (glyphs[mid].codepoint < codepoint) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < header.glyphCount && glyphs[lo].codepoint == codepoint) return &glyphs[lo];
+    return fallback;
+}
+
+const FontGlyph* BitmapFont::nextGlyph(GlyphCursor& cursor, int32_t& left) const {
+    while (*cursor.next) {
+        const FontGlyph* g = findGlyph(utf8Next(cursor.next));
+        if (!g) continue;
+        // Kern on the glyph actually drawn, so substituted characters pair like the default glyph
+        if (cursor.previous) cursor.pen += getKerning(cursor.previous, g->codepoint);
+        left = cursor.pen + g->xOffset;
+        cursor.pen += g->advance;
+        cursor.previous = g->codepoint;
+        return g;
+    }
+    return nullptr;
+}
+
+int8_t BitmapFont::getKerning(uint16_t left, uint16_t right) const {
+    uint32_t key = ((uint32_t)left << 16) | right;
+    uint16_t lo = 0, hi = header.kernCount;
+    while (lo < hi) {
+        uint16_t mid = (lo + hi) >> 1;
+        uint32_t k = ((uint32_t)kerning[mid].left << 16) | kerning[mid].right;
+        if (k < key) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < header.kernCount && kerning[lo].left == left && kerning[lo].right == right) {
+        return kerning[lo].adjust;
+    }
+    return 0;
+}
+
+const uint8_t* BitmapFont::getGlyphBitmap(const FontGlyph* glyph) {
+    if (bitmaps) return bitmaps + glyph->offset;
+
+    useClock++;
+    CacheSlot* victim = &cache[0];
+    for (uint8_t i = 0; i < FONT_CACHE_SLOTS; i++) {
+        if (cache[i].glyph == glyph) {
+            cache[i].lastUse = useClock;
+            cacheHits++;
+            return cache[i].data;
+        }
+        if (cache[i].lastUse < victim->lastUse) victim = &cache[i];
+    }
+
+    cacheMisses++;
+    size_t bytes = (size_t)glyph->width * columnBytes;
+    file.seek(bitmapStart + glyph->offset);
+    file.read(victim->data, bytes);
+    victim->glyph = glyph;
+    victim->lastUse = useClock;
+    return victim->data;
+}
+
+uint16_t BitmapFont::getTextWidth(const char* text) {
+    // FNV-1a over the string identifies it in the width cache
+    uint32_t hash = 2166136261UL;
+    uint16_t length = 0;
+    for (const char* p = text; *p; p++, length++) hash = (hash ^ (uint8_t)*p) * 16777619UL;
+    for (uint8_t i = 0; i < FONT_WIDTH_CACHE; i++) {
+        if (widths[i].hash == hash && widths[i].length == length && length < FONT_WIDTH_CACHE_BYTES &&
+            memcmp(widths[i].text, text, length) == 0) {
+            return widths[i].width;
+        }
+    }
+
+    GlyphCursor cursor(text);
+    int32_t left;
+    int32_t right = 0;
+    while (const FontGlyph* g = nextGlyph(cursor, left)) {
+        if (left + g->width > right) right = left + g->width;
+    }
+    uint16_t width = constrain(right, 0, 0xFFFF);
+
+    if (length < FONT_WIDTH_CACHE_BYTES) {
+        WidthEntry& entry = widths[nextWidth];
+        entry.hash = hash;
+        entry.length = length;
+        entry.width = width;
+        memcpy(entry.text, text, length + 1);
+        nextWidth = (nextWidth + 1) % FONT_WIDTH_CACHE;
+    }
+    return width;
+}
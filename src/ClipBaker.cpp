@@ -0,0 +1,117 @@
+#include "frame_io/ClipBaker.h"
+
+String ClipBaker::getBakedPath(const char* clipPath) {
+    String path(clipPath);
+    int dot = path.lastIndexOf('.');
+    int slash = path.lastIndexOf('/');
+    if (dot > slash) path = path.substring(0, dot);
+    return path + ".baked.lfx";
+}
+
+bool ClipBaker::readBakedHeader(const char* bakedPath, LfxHeader& header, LfxPhysicalHeader& physical) {
+    File file = LittleFS.open(bakedPath, "r");
+    if (!file) return false;
+    bool ok = file.readBytes((char*)&header, sizeof(header)) == sizeof(header) &&
+              file.readBytes((char*)&physical, sizeof(physical)) == sizeof(physical) &&
+              strncmp(header.magic, "LFX1", 4) == 0 && header.format == LFX_FORMAT_RGB888_PHYSICAL &&
+              file.size() == sizeof(header) + sizeof(physical) + (size_t)header.frames * LFX_FRAME_BYTES;
+    file.close();
+    return ok;
+}
+
+FsFrameSource* ClipBaker::open(const char* clipPath) {
+    if (!matrix || !LittleFS.exists(clipPath)) return nullptr;
+
+    File clip = LittleFS.open(clipPath, "r");
+    if (!clip) return nullptr;
+    LfxPhysicalHeader wanted;
+    wanted.mappingHash = matrix->getMappingHash();
+    wanted.sourceBytes = clip.size();
+    wanted.sourceTime = (uint32_t)clip.getLastWrite();
+    clip.close();
+
+    String bakedPath = getBakedPath(clipPath);
+    if (LittleFS.exists(bakedPath.c_str())) {
+        LfxHeader header;
+        LfxPhysicalHeader physical;
+        if (readBakedHeader(bakedPath.c_str(), header, physical) && physical.mappingHash == wanted.mappingHash &&
+            physical.sourceBytes == wanted.sourceBytes && physical.sourceTime == wanted.sourceTime) {
+            FsFrameSource* baked = new FsFrameSource(bakedPath.c_str());
+            if (baked->isPhysical()) return baked;
+            delete baked;
+        }
+        // Stale: remove it now, so its space counts towards the new bake
+        Serial.printf("⚠ %s is stale, baking it again\n", bakedPath.c_str());
+        LittleFS.remove(bakedPath.c_str());
+    }
+
+    // Read synchronously and kept out of the clip cache: the clip plays from the baked copy
+    FsFrameSource logical(clipPath, 0);
+    if (logical.getFrameCount() == 0) return nullptr;
+
+    // Baked frames are raw RGB888 whatever the clip's format
+    size_t bakedBytes = sizeof(LfxHeader) + sizeof(LfxPhysicalHeader) + (size_t)logical.getFrameCount() * LFX_FRAME_BYTES;
+    size_t freeBytes = LittleFS.totalBytes() - LittleFS.usedBytes();
+    if (bakedBytes + CLIP_BAKE_FREE_MARGIN > freeBytes) {
+        Serial.printf("⚠ Not baking %s: needs %lu KB, %lu KB free on LittleFS; playing it through the remap\n",
+                      clipPath, (unsigned long)(bakedBytes / 1024), (unsigned long)(freeBytes / 1024));
+        return nullptr;
+    }
+    if (bakedBytes > 2 * wanted.sourceBytes) {
+        Serial.printf("⚠ Baked copy of %s takes %lu KB of flash, the clip %lu KB\n", clipPath,
+                      (unsigned long)(bakedBytes / 1024), (unsigned long)(wanted.sourceBytes / 1024));
+    }
+
+    uint32_t start = millis();
+    bool ok = bake(bakedPath.c_str(), &logical, wanted);
+    ClipCache::shared().drop(clipPath);
+    if (!ok) {
+        Serial.printf("✗ Could not bake %s, playing it through the remap\n", clipPath);
+        return nullptr;
+    }
+
+    FsFrameSource* baked = new FsFrameSource(bakedPath.c_str());
+    if (!baked->isPhysical()) {
+        delete baked;
+        return nullptr;
+    }
+    Serial.printf("✓ Baked %s for this wall (%u frames, %lu ms)\n", bakedPath.c_str(),
+                  baked->getFrameCount(), (unsigned long)(millis() - start));
+    return baked;
+}
+
+bool ClipBaker::bake(const char* bakedPath, IFrameSource* logical, const LfxPhysicalHeader& physical) {
+    // Written under a temporary name, so a power cut never leaves a truncated clip
+    String tempPath = String(bakedPath) + ".tmp";
+    CRGB* frame = (CRGB*)malloc(LFX_FRAME_BYTES);
+    CRGB* leds = (CRGB*)malloc(LFX_FRAME_BYTES);
+    File out = LittleFS.open(tempPath.c_str(), "w");
+    bool ok = frame && leds && out;
+
+    if (ok) {
+        LfxHeader header;
+        memcpy(header.magic, "LFX1", 4);
+        header.width = TOTAL_SIZE;
+        header.height = TOTAL_SIZE;
+        header.frames = logical->getFrameCount();
+        header.format = LFX_FORMAT_RGB888_PHYSICAL;
+        ok = out.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+             out.write((const uint8_t*)&physical, sizeof(physical)) == sizeof(physical);
+
+        for (uint16_t i = 0; ok && i < header.frames; i++) {
+            logical->getFrameInto(i, frame);
+            matrix->render(frame, leds);
+            ok = out.write((const uint8_t*)leds, LFX_FRAME_BYTES) == LFX_FRAME_BYTES;
+        }
+    }
+    if (out) out.close();
+    free(frame);
+    free(leds);
+
+    if (ok) {
+        LittleFS.remove(bakedPath);
+        ok = LittleFS.rename(tempPath.c_str(), bakedPath);
+    }
+    if (!ok) LittleFS.remove(tempPath.c_str());
+    return ok;
+}
@@ -0,0 +1,159 @@
+#include "frame_io/ClipCache.h"
+
+ClipCache::ClipCache()
+    : budget((uint32_t)CLIP_CACHE_DEFAULT_KB * 1024), used(0), useClock(0), nextSerial(1) {
+    memset(&stats, 0, sizeof(stats));
+    for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+        entries[i].data = nullptr;
+        entries[i].loaded = nullptr;
+        entries[i].bytes = 0;
+        entries[i].serial = 0;
+    }
+}
+
+ClipCache& ClipCache::shared() {
+    static ClipCache cache;
+    return cache;
+}
+
+ClipCache::Entry* ClipCache::resolve(const ClipHandle& handle) {
+    if (handle.slot < 0 || handle.slot >= CLIP_CACHE_MAX_CLIPS) return nullptr;
+    Entry& e = entries[handle.slot];
+    return e.data && e.serial == handle.serial ? &e : nullptr;
+}
+
+void ClipCache::evict(uint8_t slot) {
+    Entry& e = entries[slot];
+    if (!e.data) return;
+    free(e.data);
+    free(e.loaded);
+    used -= e.bytes;
+    e.data = nullptr;
+    e.loaded = nullptr;
+    e.bytes = 0;
+    e.serial = 0;
+    e.path = "";
+    stats.evictions++;
+}
+
+void ClipCache::setBudget(uint32_t bytes) {
+    budget = bytes;
+    while (used > budget) {
+        // Oldest first
+        int8_t oldest = -1;
+        for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+            if (entries[i].data && (oldest < 0 || entries[i].lastUse < entries[oldest].lastUse)) oldest = i;
+        }
+        if (oldest < 0) break;
+        evict(oldest);
+    }
+}
+
+ClipHandle ClipCache::open(const char* path, uint32_t fileSize, uint32_t fileTime, uint16_t frames, uint32_t frameBytes) {
+    ClipHandle handle;
+    useClock++;
+
+    for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+        Entry& e = entries[i];
+        if (!e.data || e.path != path) continue;
+        if (e.fileSize == fileSize && e.fileTime == fileTime && e.frames == frames && e.frameBytes == frameBytes) {
+            e.lastUse = useClock;
+            handle.slot = i;
+            handle.serial = e.serial;
+            return handle;
+        }
+        evict(i);   // The file was replaced since it was cached
+    }
+
+    uint32_t bytes = (uint32_t)frames * frameBytes;
+    if (bytes == 0 || bytes > budget) {
+        stats.rejected++;
+        return handle;
+    }
+
+    // Make room: least recently played clips go first, and a slot must be free
+    for (;;) {
+        int8_t freeSlot = -1;
+        int8_t oldest = -1;
+        for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+            if (!entries[i].data) {
+                if (freeSlot < 0) freeSlot = i;
+            } else if (oldest < 0 || entries[i].lastUse < entries[oldest].lastUse) {
+                oldest = i;
+            }
+        }
+        if (freeSlot >= 0 && used + bytes <= budget) {
+            handle.slot = freeSlot;
+            break;
+        }
+        if (oldest < 0) return handle;
+        evict(oldest);
+    }
+
+    Entry& e = entries[handle.slot];
+    e.data = (uint8_t*)ps_malloc(bytes);
+    e.loaded = (uint8_t*)calloc((frames + 7) / 8, 1);
+    if (!e.data || !e.loaded) {
+        free(e.data);
+        free(e.loaded);
+        e.data = nullptr;
+        e.loaded = nullptr;
+        stats.rejected++;
+        Serial.printf("⚠ Clip cache: no PSRAM for %s (%lu KB)\n", path, (unsigned long)(bytes / 1024));
+        handle.slot = -1;
+        return handle;
+    }
+    e.path = path;
+    e.fileSize = fileSize;
+    e.fileTime = fileTime;
+    e.bytes = bytes;
+    e.frames = frames;
+    e.framesLoaded = 0;
+    e.frameBytes = frameBytes;
+    e.lastUse = useClock;
+    e.serial = nextSerial++;
+    used += bytes;
+    handle.serial = e.serial;
+    return handle;
+}
+
+const uint8_t* ClipCache::getFrame(const ClipHandle& handle, uint16_t frame) {
+    Entry* e = resolve(handle);
+    if (!e || frame >= e->frames) return nullptr;
+    e->lastUse = ++useClock;
+    if (!(e->loaded[frame >> 3] & (1 << (frame & 7)))) {
+        stats.misses++;
+        return nullptr;
+    }
+    stats.hits++;
+    return e->data + (uint32_t)frame * e->frameBytes;
+}
+
+void ClipCache::storeFrame(const ClipHandle& handle, uint16_t frame, const uint8_t* src) {
+    Entry* e = resolve(handle);
+    if (!e || frame >= e->frames) return;
+    uint8_t bit = 1 << (frame & 7);
+    if (e->loaded[frame >> 3] & bit) return;
+    memcpy(e->data + (uint32_t)frame * e->frameBytes, src, e->frameBytes);
+    e->loaded[frame >> 3] |= bit;
+    e->framesLoaded++;
+}
+
+void ClipCache::drop(const char* path) {
+    for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+        if (entries[i].data && entries[i].path == path) evict(i);
+    }
+}
+
+const ClipCacheStats& ClipCache::getStats() {
+    stats.budgetBytes = budget;
+    stats.usedBytes = used;
+    stats.loadedBytes = 0;
+    stats.clips = 0;
+    for (uint8_t i = 0; i < CLIP_CACHE_MAX_CLIPS; i++) {
+        if (!entries[i].data) continue;
+        stats.clips++;
+        stats.loadedBytes += (uint32_t)entries[i].framesLoaded * entries[i].frameBytes;
+    }
+    return stats;
+}
@@ -0,0 +1,124 @@
+#include "frame_io/ClipPartition.h"
+
+#include <string.h>
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#include <esp_partition.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ClipPartition::ClipPartition()
+    : base(nullptr), size(0), entries(nullptr), count(0)
+#if defined(ARDUINO)
+    , mapHandle(0)
+#else
+    , fd(-1)
+#endif
+{}
+
+ClipPartition::~ClipPartition() {
+    end();
+}
+
+bool ClipPartition::parse() {
+    if (size < sizeof(ClipPackHeader)) return false;
+    const ClipPackHeader* header = (const ClipPackHeader*)base;
+    if (memcmp(header->magic, "LFXP", 4) != 0 || header->version != 1) return false;
+    size_t dirEnd = sizeof(ClipPackHeader) + (size_t)header->count * sizeof(ClipPackEntry);
+    if (dirEnd > size) return false;
+
+    // Every clip must lie inside the mapping
+    entries = (const ClipPackEntry*)(base + sizeof(ClipPackHeader));
+    for (uint16_t i = 0; i < header->count; i++) {
+        const ClipPackEntry& e = entries[i];
+        if (e.offset < dirEnd || e.offset > size || e.size > size - e.offset) return false;
+        if (memchr(e.name, 0, sizeof(e.name)) == nullptr) return false;
+    }
+    count = header->count;
+    return true;
+}
+
+int16_t ClipPartition::find(const char* name) const {
+    for (uint16_t i = 0; i < count; i++) {
+        if (strcmp(entries[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+#if defined(ARDUINO)
+
+bool ClipPartition::begin(const char* label) {
+    end();
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)CLIP_PARTITION_SUBTYPE, label);
+    if (!part) return false;
+
+    // Reads go through the flash cache, like PROGMEM data
+    const void* ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &handle) != ESP_OK) {
+        Serial.printf("✗ Cannot map clip partition '%s'\n", label);
+        return false;
+    }
+    base = (const uint8_t*)ptr;
+    size = part->size;
+    mapHandle = handle;
+    if (!parse()) {
+        Serial.printf("⚠ Clip partition '%s' holds no clip directory\n", label);
+        end();
+        return false;
+    }
+    Serial.printf("✓ Clip partition mapped: %u clips, %u KB\n", count, (unsigned)(size / 1024));
+    return true;
+}
+
+void ClipPartition::end() {
+    if (base) spi_flash_munmap(mapHandle);
+    base = nullptr;
+    size = 0;
+    entries = nullptr;
+    count = 0;
+    mapHandle = 0;
+}
+
+#else // host build: mmap an image file
+
+bool ClipPartition::begin(const char* path) {
+    end();
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        end();
+        return false;
+    }
+    void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        end();
+        return false;
+    }
+    base = (const uint8_t*)ptr;
+    size = st.st_size;
+    if (!parse()) {
+        end();
+        return false;
+    }
+    return true;
+}
+
+void ClipPartition::end() {
+    if (base) munmap((void*)base, size);
+    if (fd >= 0) close(fd);
+    base = nullptr;
+    size = 0;
+    entries = nullptr;
+    count = 0;
+    fd = -1;
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "ConfigManager.h"
+#include "frame_io/ClipCache.h"
 
-ConfigManager::ConfigManager() {
+ConfigManager::ConfigManager() : animationOptionCount(0) {
     // Constructor
 }
 
@@ -34,6 +35,29 @@ PanelConfig ConfigManager::setup() {
     Serial.printf("Default Animation: %s\n", defaultAnimationName.c_str());
     Serial.printf("Auto Cycle: %d ms\n", defaultAutoCycleMs);
     Serial.printf("FS Animation Path: %s\n", defaultFsAnimationPath.c_str());
+    if (textFontPath.length() > 0) {
+        Serial.printf("Text Font: %s\n", textFontPath.c_str());
+    }
+    Serial.printf("Render Bands: %d\n", renderBands);
+    if (statsIntervalMs > 0) {
+        Serial.printf("Frame Stats: every %lu ms\n", (unsigned long)statsIntervalMs);
+    }
+    Serial.printf("Clip Cache: %lu KB\n", (unsigned long)clipCacheKB);
+    Serial.printf("Bake Clips: %s\n", bakeClips ? "yes" : "no");
+    if (audioSource.length() > 0) {
+        Serial.printf("Audio: %s (BCK %d, WS %d, SD %d, %lu Hz)\n", audioSource.c_str(),
+                      audioBckPin, audioWsPin, audioDataPin, (unsigned long)audioSampleRate);
+    }
+    for (uint8_t i = 0; i < animationOptionCount; i++) {
+        Serial.printf("  %s: renderScale=%d, upscale=%s",
+                      animationOptions[i].name.c_str(), animationOptions[i].renderScale,
+                      animationOptions[i].upscale == UPSCALE_BILINEAR ? "bilinear" : "nearest");
+        for (uint8_t p = 0; p < animationOptions[i].postCount; p++) {
+            Serial.printf("%s%s", p == 0 ? ", post=" : "+",
+                          PostProcessor::passName(animationOptions[i].post[p].type));
+        }
+        Serial.println();
+    }
     Serial.println("=========================");
     
     // Print LED hardware settings
@@ -115,6 +139,19 @@ void ConfigManager::applyDefaults(PanelConfig& config) {
     defaultAnimationName = "TestPattern";
     defaultAutoCycleMs = 0;
     defaultFsAnimationPath = "/animations/example.lfx";
+    textFontPath = "";
+    renderBands = 1;
+    statsIntervalMs = 0;
+    clipCacheKB = CLIP_CACHE_DEFAULT_KB;
+    bakeClips = false;
+    animationOptionCount = 0;
+
+    // Audio defaults (disabled)
+    audioSource = "";
+    audioBckPin = 4;
+    audioWsPin = 5;
+    audioDataPin = 6;
+    audioSampleRate = 22050;
     
     // LED hardware defaults
     ledDataPin = 8;
@@ -348,6 +385,53 @@ bool ConfigManager::loadConfigFromFile(const char* path, PanelConfig& config) {
     if (doc.containsKey("fsAnimationPath") && doc["fsAnimationPath"].is<const char*>()) {
         defaultFsAnimationPath = String((const char*)doc["fsAnimationPath"]);
     }
+    if (doc.containsKey("textFont") && doc["textFont"].is<const char*>()) {
+        textFontPath = String((const char*)doc["textFont"]);
+    }
+    if (doc.containsKey("renderBands")) {
+        uint8_t bands = doc["renderBands"];
+        if (bands >= 1 && bands <= MAX_RENDER_BANDS) {
+            renderBands = bands;
+        } else {
+            Serial.printf("⚠ Invalid renderBands: %d, using default: 1\n", bands);
+        }
+    }
+    
+    if (doc.containsKey("statsIntervalMs")) {
+        statsIntervalMs = doc["statsIntervalMs"].as<uint32_t>();
+    }
+
+    if (doc.containsKey("clipCacheKB")) {
+        clipCacheKB = doc["clipCacheKB"].as<uint32_t>();
+    }
+
+    if (doc.containsKey("bakeClips")) {
+        bakeClips = doc["bakeClips"].as<bool>();
+    }
+    
+    if (doc.containsKey("animations") && doc["animations"].is<JsonObject>()) {
+        loadAnimationOptions(doc["animations"]);
+    }
+
+    // Load audio input settings (optional)
+    if (doc.containsKey("audio") && doc["audio"].is<JsonObject>()) {
+        JsonObject audio = doc["audio"];
+        if (audio["source"].is<const char*>()) {
+            audioSource = String((const char*)audio["source"]);
+            if (audioSource == "none") audioSource = "";
+        }
+        if (audio.containsKey("bckPin")) audioBckPin = audio["bckPin"];
+        if (audio.containsKey("wsPin")) audioWsPin = audio["wsPin"];
+        if (audio.containsKey("dataPin")) audioDataPin = audio["dataPin"];
+        if (audio.containsKey("sampleRate")) {
+            uint32_t rate = audio["sampleRate"];
+            if (rate >= 8000 && rate <= 48000) {
+                audioSampleRate = rate;
+            } else {
+                Serial.printf("⚠ Invalid audio sampleRate: %lu, using default: 22050\n", (unsigned long)rate);
+            }
+        }
+    }
     
     // Load LED hardware settings (optional)
     if (doc.containsKey("ledDataPin")) {
@@ -380,6 +464,97 @@ bool ConfigManager::loadConfigFromFile(const char* path, PanelConfig& config) {
     return true;
 }
 
+void ConfigManager::loadAnimationOptions(JsonObject animations) {
+    animationOptionCount = 0;
+    
+    for (JsonPair entry : animations) {
+        if (animationOptionCount >= MAX_ANIMATION_OPTIONS) {
+            Serial.printf("⚠ Too many animation entries, ignoring the rest (max %d)\n", MAX_ANIMATION_OPTIONS);
+            break;
+        }
+        if (!entry.value().is<JsonObject>()) {
+            Serial.printf("⚠ Invalid options for animation '%s', skipping\n", entry.key().c_str());
+            continue;
+        }
+        
+        JsonObject opts = entry.value();
+        AnimationOptions& out = animationOptions[animationOptionCount];
+        out.name = entry.key().c_str();
+        out.renderScale = 1;
+        out.upscale = UPSCALE_NEAREST;
+        out.postCount = 0;
+        
+        if (opts.containsKey("renderScale")) {
+            uint8_t scale = opts["renderScale"];
+            if (scale == 1 || scale == 2 || scale == 4 || scale == 8) {
+                out.renderScale = scale;
+            } else {
+                Serial.printf("⚠ Invalid renderScale for '%s': %d (must be 1, 2, 4 or 8)\n", 
+                             out.name.c_str(), scale);
+            }
+        }
+        if (opts.containsKey("upscale") && opts["upscale"].is<const char*>()) {
+            String filter = (const char*)opts["upscale"];
+            if (filter == "bilinear") {
+                out.upscale = UPSCALE_BILINEAR;
+            } else if (filter != "nearest") {
+                Serial.printf("⚠ Invalid upscale for '%s': %s, using nearest\n", 
+                             out.name.c_str(), filter.c_str());
+            }
+        }
+        if (opts.containsKey("post") && opts["post"].is<JsonArray>()) {
+            for (JsonVariant passJson : opts["post"].as<JsonArray>()) {
+                if (out.postCount >= MAX_POST_PASSES) {
+                    Serial.printf("⚠ Too many post passes for '%s' (max %d)\n", out.name.c_str(), MAX_POST_PASSES);
+                    break;
+                }
+                if (passJson.is<JsonObject>() && parsePostPass(passJson, out.post[out.postCount], out.name)) {
+                    out.postCount++;
+                }
+            }
+        }
+        
+        animationOptionCount++;
+    }
+}
+
+// One entry of an animation's "post" array, e.g. {"pass": "blur", "radius": 1, "kernel": "gaussian"}
+bool ConfigManager::parsePostPass(JsonObject json, PostPass& pass, const String& animationName) {
+    String type = json["pass"] | "";
+    pass.p0 = 0;
+    pass.p1 = 0;
+
+    if (type == "blur") {
+        pass.type = POST_BLUR;
+        pass.p0 = constrain(json["radius"] | 1, 1, 3);
+        pass.p1 = strcmp(json["kernel"] | "gaussian", "box") == 0 ? 0 : 1;
+    } else if (type == "trails") {
+        pass.type = POST_TRAILS;
+        pass.p0 = constrain(json["fade"] | 32, 0, 255);
+    } else if (type == "levels") {
+        pass.type = POST_LEVELS;
+        pass.p0 = constrain(json["brightness"] | 255, 0, 255);
+        pass.p1 = constrain(json["contrast"] | 128, 0, 255);
+    } else if (type == "mirror") {
+        pass.type = POST_MIRROR;
+        String axis = json["axis"] | "h";
+        if (axis == "h") pass.p0 = POST_MIRROR_H;
+        else if (axis == "v") pass.p0 = POST_MIRROR_V;
+        else if (axis == "both") pass.p0 = POST_MIRROR_H | POST_MIRROR_V;
+        else {
+            Serial.printf("⚠ Invalid mirror axis for '%s': %s (must be h, v or both)\n",
+                         animationName.c_str(), axis.c_str());
+            return false;
+        }
+    } else if (type == "kaleidoscope") {
+        pass.type = POST_KALEIDOSCOPE;
+    } else {
+        Serial.printf("⚠ Unknown post pass for '%s': %s\n", animationName.c_str(), type.c_str());
+        return false;
+    }
+    return true;
+}
+
 bool ConfigManager::loadDefaultConfig(PanelConfig& config) {
     return loadConfigFromFile(DEFAULT_CONFIG_PATH, config);
 }
@@ -435,6 +610,52 @@ String ConfigManager::exportConfigJSON(const PanelConfig& config) {
     doc["defaultAnimation"] = defaultAnimationName;
     doc["autoCycleMs"] = defaultAutoCycleMs;
     doc["fsAnimationPath"] = defaultFsAnimationPath;
+    doc["textFont"] = textFontPath;
+    doc["renderBands"] = renderBands;
+    doc["statsIntervalMs"] = statsIntervalMs;
+    doc["clipCacheKB"] = clipCacheKB;
+    doc["bakeClips"] = bakeClips;
+
+    JsonObject audio = doc["audio"].to<JsonObject>();
+    audio["source"] = audioSource.length() > 0 ? audioSource : String("none");
+    audio["bckPin"] = audioBckPin;
+    audio["wsPin"] = audioWsPin;
+    audio["dataPin"] = audioDataPin;
+    audio["sampleRate"] = audioSampleRate;
+    
+    JsonObject animations = doc["animations"].to<JsonObject>();
+    for (uint8_t i = 0; i < animationOptionCount; i++) {
+        JsonObject opts = animations[animationOptions[i].name].to<JsonObject>();
+        opts["renderScale"] = animationOptions[i].renderScale;
+        opts["upscale"] = animationOptions[i].upscale == UPSCALE_BILINEAR ? "bilinear" : "nearest";
+        if (animationOptions[i].postCount == 0) continue;
+
+        JsonArray postJson = opts["post"].to<JsonArray>();
+        for (uint8_t p = 0; p < animationOptions[i].postCount; p++) {
+            const PostPass& pass = animationOptions[i].post[p];
+            JsonObject passJson = postJson.add<JsonObject>();
+            passJson["pass"] = PostProcessor::passName(pass.type);
+            switch (pass.type) {
+                case POST_BLUR:
+                    passJson["radius"] = pass.p0;
+                    passJson["kernel"] = pass.p1 ? "gaussian" : "box";
+                    break;
+                case POST_TRAILS:
+                    passJson["fade"] = pass.p0;
+                    break;
+                case POST_LEVELS:
+                    passJson["brightness"] = pass.p0;
+                    passJson["contrast"] = pass.p1;
+                    break;
+                case POST_MIRROR:
+                    passJson["axis"] = pass.p0 == (POST_MIRROR_H | POST_MIRROR_V) ? "both" :
+                                       pass.p0 == POST_MIRROR_V ? "v" : "h";
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
     
     // LED hardware settings
     doc["ledDataPin"] = ledDataPin;
@@ -0,0 +1,59 @@
+#include "audio/FixedFFT.h"
+#include <math.h>
+
+FixedFFT::FixedFFT() {
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE / 2; i++) {
+        double a = 2.0 * M_PI * i / AUDIO_FFT_SIZE;
+        cosTable[i] = (int16_t)lround(cos(a) * 32767.0);
+        sinTable[i] = (int16_t)lround(sin(a) * 32767.0);
+    }
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++) {
+        window[i] = (int16_t)lround((0.5 - 0.5 * cos(2.0 * M_PI * i / (AUDIO_FFT_SIZE - 1))) * 32767.0);
+
+        uint16_t r = 0;
+        for (uint8_t b = 0; b < AUDIO_FFT_LOG2; b++) {
+            if (i & (1 << b)) r |= 1 << (AUDIO_FFT_LOG2 - 1 - b);
+        }
+        bitReverse[i] = r;
+    }
+}
+
+void FixedFFT::load(const int16_t* samples, int16_t* re, int16_t* im) const {
+    for (uint16_t i = 0; i < AUDIO_FFT_SIZE; i++) {
+        re[bitReverse[i]] = (int16_t)(((int32_t)samples[i] * window[i]) >> 15);
+        im[i] = 0;
+    }
+}
+
+void FixedFFT::transform(int16_t* re, int16_t* im) const {
+    for (uint16_t half = 1, step = AUDIO_FFT_SIZE / 2; half < AUDIO_FFT_SIZE; half <<= 1, step >>= 1) {
+        for (uint16_t j = 0; j < half; j++) {
+            // W = e^(-2*pi*i*j/len) = cos - i*sin
+            int32_t wr = cosTable[j * step];
+            int32_t wi = -sinTable[j * step];
+            for (uint16_t a = j; a < AUDIO_FFT_SIZE; a += half << 1) {
+                uint16_t b = a + half;
+                int32_t tr = (re[b] * wr - im[b] * wi) >> 15;
+                int32_t ti = (re[b] * wi + im[b] * wr) >> 15;
+                int32_t ur = re[a];
+                int32_t ui = im[a];
+                re[a] = (int16_t)((ur + tr) >> 1);
+                im[a] = (int16_t)((ui + ti) >> 1);
+                re[b] = (int16_t)((ur - tr) >> 1);
+                im[b] = (int16_t)((ui - ti) >> 1);
+            }
+        }
+    }
+}
+
+void FixedFFT::magnitudes(const int16_t* re, const int16_t* im, uint16_t* mag) {
+    for (uint16_t k = 0; k < AUDIO_FFT_BINS; k++) {
+        uint16_t r = re[k] < 0 ? -re[k] : re[k];
+        uint16_t i = im[k] < 0 ? -im[k] : im[k];
+        uint16_t hi = r > i ? r : i;
+        uint16_t lo = r > i ? i : r;
+        // max + 3/8 min: within ~7% of sqrt(r^2 + i^2)
+        uint32_t m = hi + ((3u * lo) >> 3);
+        mag[k] = m > 0xFFFF ? 0xFFFF : (uint16_t)m;
+    }
+}
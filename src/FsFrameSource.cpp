@@ -0,0 +1,345 @@
+#include "frame_io/FsFrameSource.h"
+
+#if !defined(ARDUINO)
+#include <chrono>
+#endif
+
+static uint32_t nowUs() {
+#if defined(ARDUINO)
+    return micros();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+FsFrameSource::FsFrameSource(const char* filePath, uint8_t prefetchFrames)
+    : path(filePath), valid(false), frameBytes(0), dataStart(0), frameStride(0),
+      fileSize(0), fileTime(0), indexBits(0), framePalettes(false), paletteBytes(0), palette(nullptr), decoder(nullptr), depth(0), ring(nullptr), nextWanted(0),
+      cacheRejected(false), stopping(false), running(false)
+#if defined(ARDUINO)
+    , task(nullptr), slotLock(nullptr), fileLock(nullptr), doneSem(nullptr)
+#else
+    , wakePending(false)
+#endif
+{
+    memset(&header, 0, sizeof(header));
+    memset(&stats, 0, sizeof(stats));
+    for (uint8_t i = 0; i < FS_PREFETCH_FRAMES; i++) {
+        slots[i].frame = -1;
+        slots[i].ready = false;
+        slots[i].data = nullptr;
+    }
+
+    if (!LittleFS.begin()) return;
+    if (!LittleFS.exists(path)) return;
+    file = LittleFS.open(path, "r");
+    if (!file) return;
+    fileSize = file.size();
+    fileTime = (uint32_t)file.getLastWrite();
+    if (file.readBytes((char*)&header, sizeof(header)) != sizeof(header) ||
+        header.width != 32 || header.height != 32 || header.frames == 0) {
+        file.close();
+        return;
+    }
+    if (strncmp(header.magic, "LFX2", 4) == 0 && header.format == LFX_FORMAT_DELTA_RLE) {
+        fileReader.file = &file;
+        decoder = new LfxDecoder();
+        if (!decoder->begin(fileReader, header.frames, file.size())) {
+            Serial.printf("✗ Corrupt frame table in %s\n", path.c_str());
+            delete decoder;
+            decoder = nullptr;
+            file.close();
+            return;
+        }
+    } else if (strncmp(header.magic, "LFX1", 4) != 0) {
+        file.close();
+        return;
+    } else if (header.format == LFX_FORMAT_INDEXED8 || header.format == LFX_FORMAT_INDEXED4) {
+        if (!openIndexed()) {
+            Serial.printf("✗ Bad palette in %s\n", path.c_str());
+            file.close();
+            return;
+        }
+    } else if (header.format == LFX_FORMAT_RGB888) {
+        dataStart = sizeof(LfxHeader);
+        frameStride = LFX_FRAME_BYTES;
+    } else if (header.format == LFX_FORMAT_RGB888_PHYSICAL) {
+        // The LfxPhysicalHeader only matters to ClipBaker
+        dataStart = sizeof(LfxHeader) + sizeof(LfxPhysicalHeader);
+        frameStride = LFX_FRAME_BYTES;
+        if (file.size() < dataStart + (uint32_t)header.frames * frameStride) {
+            file.close();
+            return;
+        }
+    } else {
+        file.close();
+        return;
+    }
+    frameBytes = (size_t)header.width * header.height * 3;
+    valid = true;
+
+    if (prefetchFrames > 0 && header.frames > 1 && !startPrefetch(prefetchFrames)) {
+        Serial.printf("⚠ Frame prefetch unavailable, reading %s synchronously\n", path.c_str());
+    }
+}
+
+FsFrameSource::~FsFrameSource() {
+    stopPrefetch();
+    delete decoder;
+    free(palette);
+    if (file) file.close();
+}
+
+bool FsFrameSource::openIndexed() {
+    LfxPaletteHeader info;
+    if (file.read((uint8_t*)&info, sizeof(info)) != sizeof(info)) return false;
+    indexBits = header.format == LFX_FORMAT_INDEXED8 ? 8 : 4;
+    uint16_t colors = info.colors + 1;
+    if (colors > (1u << indexBits)) return false;
+
+    // Unused entries stay black, so stray indices can't read past the table
+    palette = (uint8_t*)calloc(256, 3);
+    if (!palette) return false;
+    framePalettes = info.flags & LFX_PALETTE_PER_FRAME;
+    paletteBytes = colors * 3;
+    dataStart = sizeof(LfxHeader) + sizeof(LfxPaletteHeader);
+    frameStride = LFX_PIXELS * indexBits / 8;
+    if (framePalettes) {
+        frameStride += paletteBytes;
+    } else {
+        if (file.read(palette, paletteBytes) != paletteBytes) return false;
+        dataStart += paletteBytes;
+    }
+    return file.size() >= dataStart + (uint32_t)header.frames * frameStride;
+}
+
+bool FsFrameSource::readFrame(uint16_t frameIndex, uint8_t* dst) {
+    if (decoder) return decoder->decode(fileReader, frameIndex, dst);
+    size_t offset = dataStart + (size_t)frameIndex * frameStride;
+    if (!file.seek(offset, SeekSet)) return false;
+    if (!indexBits) return file.read(dst, frameBytes) == frameBytes;
+
+    // Indices go to the end of dst and are expanded in place
+    if (framePalettes && file.read(palette, paletteBytes) != paletteBytes) return false;
+    size_t indexBytes = LFX_PIXELS * indexBits / 8;
+    uint8_t* indices = dst + frameBytes - indexBytes;
+    if (file.read(indices, indexBytes) != indexBytes) return false;
+    lfxExpandIndexed(dst, indices, palette, indexBits);
+    return true;
+}
+
+bool FsFrameSource::inWindow(uint16_t frame) const {
+    return (uint16_t)((frame + header.frames - nextWanted) % header.frames) < depth;
+}
+
+FsFrameSource::Slot* FsFrameSource::findSlot(uint16_t frame) {
+    for (uint8_t i = 0; i < depth; i++) {
+        if (slots[i].frame == frame) return &slots[i];
+    }
+    return nullptr;
+}
+
+void FsFrameSource::getFrameInto(uint16_t frameIndex, CRGB* ledsOut) {
+    if (!valid) return;
+    uint32_t start = nowUs();
+    frameIndex %= header.frames;
+
+    // CRGB is laid out r, g, b like the file's RGB888 pixels, so frames copy as bytes
+    static_assert(sizeof(CRGB) == 3, "CRGB must be packed RGB");
+
+    // PSRAM copy first; (re)join the cache when the clip starts or was evicted
+    ClipCache& cache = ClipCache::shared();
+    if (!cacheRejected && !cache.isValid(clip)) {
+        clip = cache.open(path.c_str(), fileSize, fileTime, header.frames, frameBytes);
+        cacheRejected = !clip.isSet();
+    }
+    if (clip.isSet()) {
+        const uint8_t* cached = cache.getFrame(clip, frameIndex);
+        if (cached) {
+            memcpy(ledsOut, cached, frameBytes);
+            stats.hits++;
+            stats.lastReadUs = nowUs() - start;
+            return;
+        }
+    }
+
+    bool hit = false;
+    if (depth) {
+        lockSlots();
+        Slot* slot = findSlot(frameIndex);
+        if (slot && slot->ready) {
+            memcpy(ledsOut, slot->data, frameBytes);
+            hit = true;
+        }
+        // Playback moves on: the window now starts after this frame
+        nextWanted = (frameIndex + 1) % header.frames;
+        unlockSlots();
+        wakeTask();
+    }
+
+    if (hit) {
+        stats.hits++;
+    } else {
+        stats.misses++;
+        lockFile();
+        readFrame(frameIndex, (uint8_t*)ledsOut);
+        unlockFile();
+    }
+    if (clip.isSet()) cache.storeFrame(clip, frameIndex, (const uint8_t*)ledsOut);
+
+    stats.lastReadUs = nowUs() - start;
+    if (stats.lastReadUs > stats.maxReadUs) stats.maxReadUs = stats.lastReadUs;
+}
+
+bool FsFrameSource::getStats(FrameSourceStats& out) const {
+    // fetchUs is written by the prefetch task, under the slot lock
+    if (depth) lockSlots();
+    out = stats;
+    if (depth) unlockSlots();
+    return true;
+}
+
+void FsFrameSource::prefetchLoop() {
+    while (!stopping) {
+        // Pick the first frame of the window that isn't cached, and a slot
+        // holding a frame playback has already passed
+        Slot* victim = nullptr;
+        int32_t target = -1;
+        lockSlots();
+        for (uint8_t k = 0; k < depth && target < 0; k++) {
+            uint16_t frame = (nextWanted + k) % header.frames;
+            if (!findSlot(frame)) target = frame;
+        }
+        if (target >= 0) {
+            for (uint8_t i = 0; i < depth && !victim; i++) {
+                if (slots[i].frame < 0 || (slots[i].ready && !inWindow(slots[i].frame))) victim = &slots[i];
+            }
+        }
+        if (victim) {
+            victim->frame = target;
+            victim->ready = false;
+        }
+        unlockSlots();
+
+        if (!victim) {
+            waitForWork();
+            continue;
+        }
+
+        uint32_t start = nowUs();
+        lockFile();
+        bool ok = readFrame(target, victim->data);
+        unlockFile();
+        uint32_t fetchUs = nowUs() - start;
+
+        lockSlots();
+        stats.fetchUs = fetchUs;
+        if (ok) victim->ready = true;
+        else victim->frame = -1;
+        unlockSlots();
+    }
+    running = false;
+}
+
+#if defined(ARDUINO)
+
+void FsFrameSource::lockSlots() const { xSemaphoreTake(slotLock, portMAX_DELAY); }
+void FsFrameSource::unlockSlots() const { xSemaphoreGive(slotLock); }
+void FsFrameSource::lockFile() { if (fileLock) xSemaphoreTake(fileLock, portMAX_DELAY); }
+void FsFrameSource::unlockFile() { if (fileLock) xSemaphoreGive(fileLock); }
+void FsFrameSource::wakeTask() { if (task) xTaskNotifyGive(task); }
+void FsFrameSource::waitForWork() { ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100)); }
+
+void FsFrameSource::prefetchTask(void* param) {
+    FsFrameSource* source = static_cast<FsFrameSource*>(param);
+    source->prefetchLoop();
+    xSemaphoreGive(source->doneSem);
+    vTaskDelete(nullptr);
+}
+
+bool FsFrameSource::startPrefetch(uint8_t frames) {
+    if (frames > FS_PREFETCH_FRAMES) frames = FS_PREFETCH_FRAMES;
+    ring = (uint8_t*)malloc((size_t)frames * frameBytes);
+    slotLock = xSemaphoreCreateMutex();
+    fileLock = xSemaphoreCreateMutex();
+    doneSem = xSemaphoreCreateBinary();
+    if (!ring || !slotLock || !fileLock || !doneSem) {
+        stopPrefetch();
+        return false;
+    }
+    for (uint8_t i = 0; i < frames; i++) slots[i].data = ring + (size_t)i * frameBytes;
+    depth = frames;
+    stopping = false;
+    running = true;
+
+    // Same core as the audio task; flash reads mostly wait on the SPI bus
+    if (xTaskCreatePinnedToCore(prefetchTask, "framePrefetch", 4096, this, 2, &task, 0) != pdPASS) {
+        task = nullptr;
+        running = false;
+        stopPrefetch();
+        return false;
+    }
+    Serial.printf("✓ Frame prefetch: %u frames ahead of %s\n", depth, path.c_str());
+    return true;
+}
+
+void FsFrameSource::stopPrefetch() {
+    if (task) {
+        stopping = true;
+        xTaskNotifyGive(task);
+        xSemaphoreTake(doneSem, portMAX_DELAY);
+        task = nullptr;
+    }
+    if (doneSem) vSemaphoreDelete(doneSem);
+    if (fileLock) vSemaphoreDelete(fileLock);
+    if (slotLock) vSemaphoreDelete(slotLock);
+    doneSem = fileLock = slotLock = nullptr;
+    depth = 0;
+    free(ring);
+    ring = nullptr;
+}
+
+#else // host build: std::thread
+
+void FsFrameSource::lockSlots() const { slotLock.lock(); }
+void FsFrameSource::unlockSlots() const { slotLock.unlock(); }
+void FsFrameSource::lockFile() { fileLock.lock(); }
+void FsFrameSource::unlockFile() { fileLock.unlock(); }
+
+void FsFrameSource::wakeTask() {
+    {
+        std::lock_guard<std::mutex> lock(slotLock);
+        wakePending = true;
+    }
+    wakeCv.notify_one();
+}
+
+void FsFrameSource::waitForWork() {
+    std::unique_lock<std::mutex> lock(slotLock);
+    wakeCv.wait_for(lock, std::chrono::milliseconds(100), [this] { return wakePending || stopping; });
+    wakePending = false;
+}
+
+bool FsFrameSource::startPrefetch(uint8_t frames) {
+    if (frames > FS_PREFETCH_FRAMES) frames = FS_PREFETCH_FRAMES;
+    ring = (uint8_t*)malloc((size_t)frames * frameBytes);
+    if (!ring) return false;
+    for (uint8_t i = 0; i < frames; i++) slots[i].data = ring + (size_t)i * frameBytes;
+    depth = frames;
+    stopping = false;
+    running = true;
+    thread = std::thread([this] { prefetchLoop(); });
+    return true;
+}
+
+void FsFrameSource::stopPrefetch() {
+    stopping = true;
+    wakeTask();
+    if (thread.joinable()) thread.join();
+    depth = 0;
+    free(ring);
+    ring = nullptr;
+}
+
+#endif
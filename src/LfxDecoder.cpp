@@ -0,0 +1,171 @@
+#include "frame_io/LfxDecoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+LfxDecoder::LfxDecoder()
+    : offsets(nullptr), frames(0), decoded(-1),
+      pos(0), count(0), literal(false), partial(0) {
+    memset(frame, 0, sizeof(frame));
+}
+
+LfxDecoder::~LfxDecoder() {
+    end();
+}
+
+bool LfxDecoder::begin(LfxReader& reader, uint16_t frameCount, uint32_t fileSize) {
+    end();
+    if (frameCount == 0) return false;
+    size_t tableBytes = ((size_t)frameCount + 1) * sizeof(uint32_t);
+    offsets = (uint32_t*)malloc(tableBytes);
+    if (!offsets) return false;
+
+    // Little-endian on disk, like the target
+    uint32_t first = sizeof(LfxHeader) + tableBytes;
+    bool ok = reader.readAt(sizeof(LfxHeader), (uint8_t*)offsets, tableBytes) == tableBytes;
+    for (uint32_t i = 0; ok && i <= frameCount; i++) {
+        uint32_t at = offsets[i] & ~LFX_KEYFRAME;
+        uint32_t prev = i ? (offsets[i - 1] & ~LFX_KEYFRAME) : first;
+        ok = at >= prev && at <= fileSize;
+    }
+    if (!ok) {
+        end();
+        return false;
+    }
+    frames = frameCount;
+    decoded = -1;
+    return true;
+}
+
+void LfxDecoder::end() {
+    free(offsets);
+    offsets = nullptr;
+    frames = 0;
+    decoded = -1;
+}
+
+void LfxDecoder::applyRuns(const uint8_t* in, size_t len) {
+    while (len > 0) {
+        if (count == 0) {
+            uint8_t control = *in++;
+            len--;
+            literal = !(control & LFX_RUN);
+            count = (control & (LFX_RUN - 1)) + 1;
+            partial = 0;
+            continue;
+        }
+
+        // Malformed input can't write past the frame
+        uint16_t room = LFX_PIXELS - pos;
+        if (literal) {
+            if (partial == 0 && len >= 3) {
+                // Whole pixels in this chunk
+                size_t n = len / 3;
+                if (n > count) n = count;
+                if (n > room) n = room;
+                uint8_t* out = frame + pos * 3;
+                for (size_t i = 0; i < n * 3; i++) out[i] ^= in[i];
+                pos += n;
+                count -= n;
+                in += n * 3;
+                len -= n * 3;
+                if (n == 0) {
+                    // Frame full: drop the rest of the run
+                    count = 0;
+                }
+                continue;
+            }
+            // Pixel split across chunks
+            pixel[partial++] = *in++;
+            len--;
+            if (partial == 3) {
+                if (room) {
+                    uint8_t* out = frame + pos * 3;
+                    out[0] ^= pixel[0];
+                    out[1] ^= pixel[1];
+                    out[2] ^= pixel[2];
+                    pos++;
+                }
+                count--;
+                partial = 0;
+            }
+        } else {
+            pixel[partial++] = *in++;
+            len--;
+            if (partial < 3) continue;
+            uint16_t n = count < room ? count : room;
+            if (pixel[0] | pixel[1] | pixel[2]) {
+                uint8_t* out = frame + pos * 3;
+                for (uint16_t i = 0; i < n; i++, out += 3) {
+                    out[0] ^= pixel[0];
+                    out[1] ^= pixel[1];
+                    out[2] ^= pixel[2];
+                }
+            }
+            pos += n;
+            count = 0;
+        }
+    }
+}
+
+bool LfxDecoder::applyFrame(LfxReader& reader, uint16_t index) {
+    if (isKeyframe(index)) memset(frame, 0, sizeof(frame));
+    uint32_t at = offsets[index] & ~LFX_KEYFRAME;
+    uint32_t left = getFrameSize(index);
+
+    pos = 0;
+    count = 0;
+    partial = 0;
+    while (left > 0) {
+        size_t n = left < LFX_DECODE_CHUNK ? left : LFX_DECODE_CHUNK;
+        if (reader.readAt(at, chunk, n) != n) return false;
+        applyRuns(chunk, n);
+        at += n;
+        left -= n;
+    }
+    return true;
+}
+
+bool LfxDecoder::decode(LfxReader& reader, uint16_t index, uint8_t* dst) {
+    if (!offsets || index >= frames) return false;
+
+    if (decoded != index) {
+        // Continue from the frame we hold if no keyframe lies in between
+        uint16_t key = index;
+        while (!isKeyframe(key)) key--;
+        uint16_t start = (decoded >= key && decoded < index) ? decoded + 1 : key;
+        for (uint16_t i = start; i <= index; i++) {
+            if (!applyFrame(reader, i)) {
+                decoded = -1;
+                return false;
+            }
+        }
+        decoded = index;
+    }
+    memcpy(dst, frame, LFX_FRAME_BYTES);
+    return true;
+}
+
+void lfxExpandIndexed(uint8_t* frame, const uint8_t* in, const uint8_t* palette, uint8_t bits) {
+    uint8_t* out = frame;
+    if (bits == 8) {
+        for (uint16_t i = 0; i < LFX_PIXELS; i++, out += 3) {
+            const uint8_t* c = palette + in[i] * 3;
+            out[0] = c[0];
+            out[1] = c[1];
+            out[2] = c[2];
+        }
+    } else {
+        for (uint16_t i = 0; i < LFX_PIXELS / 2; i++, out += 6) {
+            uint8_t pair = in[i];
+            const uint8_t* a = palette + (pair >> 4) * 3;
+            const uint8_t* b = palette + (pair & 0x0F) * 3;
+            out[0] = a[0];
+            out[1] = a[1];
+            out[2] = a[2];
+            out[3] = b[0];
+            out[4] = b[1];
+            out[5] = b[2];
+        }
+    }
+}
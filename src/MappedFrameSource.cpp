@@ -0,0 +1,85 @@
+#include "frame_io/MappedFrameSource.h"
+
+MappedFrameSource::MappedFrameSource(const uint8_t* clipData, uint32_t size)
+    : clip(clipData), clipSize(size), valid(false), frames(nullptr), frameStride(0),
+      indexBits(0), framePalettes(false), paletteBytes(0), reader(clipData, size), decoder(nullptr) {
+    memset(&header, 0, sizeof(header));
+    memset(palette, 0, sizeof(palette));
+    if (!clip || size < sizeof(LfxHeader)) return;
+    memcpy(&header, clip, sizeof(header));
+    if (header.width != 32 || header.height != 32 || header.frames == 0) return;
+
+    if (strncmp(header.magic, "LFX2", 4) == 0 && header.format == LFX_FORMAT_DELTA_RLE) {
+        decoder = new LfxDecoder();
+        if (!decoder->begin(reader, header.frames, clipSize)) {
+            delete decoder;
+            decoder = nullptr;
+            return;
+        }
+    } else if (strncmp(header.magic, "LFX1", 4) != 0) {
+        return;
+    } else if (header.format == LFX_FORMAT_INDEXED8 || header.format == LFX_FORMAT_INDEXED4) {
+        if (!openIndexed()) return;
+    } else if (header.format == LFX_FORMAT_RGB888) {
+        frames = clip + sizeof(LfxHeader);
+        frameStride = LFX_FRAME_BYTES;
+        if (clipSize < sizeof(LfxHeader) + (uint32_t)header.frames * frameStride) return;
+    } else {
+        return;
+    }
+    valid = true;
+}
+
+MappedFrameSource::~MappedFrameSource() {
+    delete decoder;
+}
+
+bool MappedFrameSource::openIndexed() {
+    if (clipSize < sizeof(LfxHeader) + sizeof(LfxPaletteHeader)) return false;
+    LfxPaletteHeader info;
+    memcpy(&info, clip + sizeof(LfxHeader), sizeof(info));
+    indexBits = header.format == LFX_FORMAT_INDEXED8 ? 8 : 4;
+    uint16_t colors = info.colors + 1;
+    if (colors > (1u << indexBits)) return false;
+
+    framePalettes = info.flags & LFX_PALETTE_PER_FRAME;
+    paletteBytes = colors * 3;
+    uint32_t dataStart = sizeof(LfxHeader) + sizeof(LfxPaletteHeader);
+    frameStride = LFX_PIXELS * indexBits / 8;
+    if (framePalettes) {
+        frameStride += paletteBytes;
+    } else {
+        if (clipSize < dataStart + paletteBytes) return false;
+        memcpy(palette, clip + dataStart, paletteBytes);
+        dataStart += paletteBytes;
+    }
+    frames = clip + dataStart;
+    return clipSize >= dataStart + (uint32_t)header.frames * frameStride;
+}
+
+const CRGB* MappedFrameSource::getFramePointer(uint16_t frameIndex) {
+    if (!valid || decoder || indexBits) return nullptr;
+    // CRGB is laid out r, g, b like the file's RGB888 pixels
+    static_assert(sizeof(CRGB) == 3, "CRGB must be packed RGB");
+    return (const CRGB*)(frames + (size_t)(frameIndex % header.frames) * frameStride);
+}
+
+void MappedFrameSource::getFrameInto(uint16_t frameIndex, CRGB* ledsOut) {
+    if (!valid) return;
+    frameIndex %= header.frames;
+    if (decoder) {
+        decoder->decode(reader, frameIndex, (uint8_t*)ledsOut);
+        return;
+    }
+
+    const uint8_t* src = frames + (size_t)frameIndex * frameStride;
+    if (!indexBits) {
+        memcpy(ledsOut, src, LFX_FRAME_BYTES);
+        return;
+    }
+    if (framePalettes) {
+        memcpy(palette, src, paletteBytes);
+        src += paletteBytes;
+    }
+    lfxExpandIndexed((uint8_t*)ledsOut, src, palette, indexBits);
+}
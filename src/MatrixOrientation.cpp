@@ -1,6 +1,6 @@
 #include "MatrixOrientation.h"
 
-MatrixOrientation::MatrixOrientation() {
+MatrixOrientation::MatrixOrientation() : foldGatherMask(0xFF) {
     // Initialize with default configuration
     config.matrixWidth = 2;
     config.matrixHeight = 2;
@@ -24,6 +24,8 @@ MatrixOrientation::MatrixOrientation() {
 }
 
 void MatrixOrientation::begin() {
+    foldGatherMask = 0xFF;
+
     // Initialize with default settings
     Serial.println("MatrixOrientation initialized");
     Serial.printf("Panel layout: %dx%d (%dx%d total)\n", 
@@ -96,6 +98,18 @@ uint8_t MatrixOrientation::getPhysicalPanelIndex(uint8_t logicalPanelX, uint8_t
     return 0;
 }
 
+uint32_t MatrixOrientation::getMappingHash() {
+    uint32_t hash = 2166136261u;
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            uint16_t ledIndex = getLEDIndex(x, y);
+            hash = (hash ^ (ledIndex & 0xFF)) * 16777619u;
+            hash = (hash ^ (ledIndex >> 8)) * 16777619u;
+        }
+    }
+    return hash;
+}
+
 uint16_t MatrixOrientation::getLEDIndex(uint8_t x, uint8_t y) {
     if (x >= TOTAL_SIZE || y >= TOTAL_SIZE) {
         return 0; // Invalid coordinates
@@ -220,9 +234,94 @@ void MatrixOrientation::render(CRGB* pixelArt, CRGB* leds) {
     }
 }
 
+void MatrixOrientation::renderRect(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t x, uint8_t y, uint8_t w, uint8_t h, CRGB* leds) {
+    uint8_t xEnd = x + w < TOTAL_SIZE ? x + w : TOTAL_SIZE;
+    uint8_t yEnd = y + h < TOTAL_SIZE ? y + h : TOTAL_SIZE;
+    for (uint8_t py = y; py < yEnd; py++) {
+        for (uint8_t px = x; px < xEnd; px++) {
+            leds[getLEDIndex(px, py)] = pixelArt[py][px];
+        }
+    }
+}
+
+void MatrixOrientation::renderUpscaled(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t srcWidth, uint8_t srcHeight,
+                                       CRGB* leds, UpscaleFilter filter) {
+    if (srcWidth == 0 || srcHeight == 0 || srcWidth > TOTAL_SIZE || srcHeight > TOTAL_SIZE) return;
+
+    if (filter == UPSCALE_NEAREST) {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            const CRGB* srcRow = pixelArt[y * srcHeight / TOTAL_SIZE];
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                leds[getLEDIndex(x, y)] = srcRow[x * srcWidth / TOTAL_SIZE];
+            }
+        }
+        return;
+    }
+
+    // Bilinear: map each output pixel centre into source space as 8.8 fixed point,
+    // clamped so the right/bottom neighbour stays inside the source image
+    uint8_t colIndex[TOTAL_SIZE];
+    uint8_t colFrac[TOTAL_SIZE];
+    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+        int32_t pos = ((2 * x + 1) * srcWidth * 256) / (2 * TOTAL_SIZE) - 128;
+        pos = constrain(pos, 0, (srcWidth - 1) * 256);
+        colIndex[x] = pos >> 8;
+        colFrac[x] = pos & 0xFF;
+    }
+
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        int32_t pos = ((2 * y + 1) * srcHeight * 256) / (2 * TOTAL_SIZE) - 128;
+        pos = constrain(pos, 0, (srcHeight - 1) * 256);
+        uint8_t y0 = pos >> 8;
+        uint8_t y1 = y0 + 1 < srcHeight ? y0 + 1 : y0;
+        uint8_t fy = pos & 0xFF;
+        const CRGB* row0 = pixelArt[y0];
+        const CRGB* row1 = pixelArt[y1];
+
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            uint8_t x0 = colIndex[x];
+            uint8_t x1 = x0 + 1 < srcWidth ? x0 + 1 : x0;
+            uint8_t fx = colFrac[x];
+            CRGB out;
+            for (uint8_t c = 0; c < 3; c++) {
+                uint8_t top = lerp8by8(row0[x0][c], row0[x1][c], fx);
+                uint8_t bottom = lerp8by8(row1[x0][c], row1[x1][c], fx);
+                out[c] = lerp8by8(top, bottom, fy);
+            }
+            leds[getLEDIndex(x, y)] = out;
+        }
+    }
+}
+
+void MatrixOrientation::buildFoldGather(uint8_t foldMask) {
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            uint8_t sx = (foldMask & FOLD_X) && x >= TOTAL_SIZE / 2 ? TOTAL_SIZE - 1 - x : x;
+            uint8_t sy = (foldMask & FOLD_Y) && y >= TOTAL_SIZE / 2 ? TOTAL_SIZE - 1 - y : y;
+            if ((foldMask & FOLD_DIAGONAL) && sy > sx) {
+                uint8_t t = sx;
+                sx = sy;
+                sy = t;
+            }
+            foldGather[getLEDIndex(x, y)] = sy * TOTAL_SIZE + sx;
+        }
+    }
+    foldGatherMask = foldMask;
+}
+
+void MatrixOrientation::renderFolded(CRGB pixelArt[TOTAL_SIZE][TOTAL_SIZE], uint8_t foldMask, CRGB* leds) {
+    if (foldMask != foldGatherMask) buildFoldGather(foldMask);
+
+    const CRGB* src = &pixelArt[0][0];
+    for (uint16_t i = 0; i < TOTAL_LEDS; i++) {
+        leds[i] = src[foldGather[i]];
+    }
+}
+
 void MatrixOrientation::setPanelRotation(uint8_t panel, uint8_t rotation) {
     if (panel < NUM_PANELS && (rotation == 0 || rotation == 90 || rotation == 180 || rotation == 270)) {
         config.panelRotation[panel] = rotation;
+        foldGatherMask = 0xFF;
         Serial.printf("Panel %d rotation set to %d degrees\n", panel, rotation);
     }
 }
@@ -230,6 +329,7 @@ void MatrixOrientation::setPanelRotation(uint8_t panel, uint8_t rotation) {
 void MatrixOrientation::setPanelOrder(uint8_t position, uint8_t physicalPanel) {
     if (position < NUM_PANELS && physicalPanel < NUM_PANELS) {
         config.panelOrder[position] = physicalPanel;
+        foldGatherMask = 0xFF;
         Serial.printf("Position %d mapped to physical panel %d\n", position, physicalPanel);
     }
 }
@@ -237,6 +337,7 @@ void MatrixOrientation::setPanelOrder(uint8_t position, uint8_t physicalPanel) {
 void MatrixOrientation::setSerpentine(uint8_t panel, bool enabled) {
     if (panel < NUM_PANELS) {
         config.serpentine[panel] = enabled;
+        foldGatherMask = 0xFF;
         Serial.printf("Panel %d serpentine: %s\n", panel, enabled ? "enabled" : "disabled");
     }
 }
@@ -0,0 +1,193 @@
+#include "render/NoiseField.h"
+
+// Eight gradient directions (axes and diagonals)
+static const int8_t GRAD_X[8] = {1, -1, 0, 0, 1, -1, 1, -1};
+static const int8_t GRAD_Y[8] = {0, 0, 1, -1, 1, 1, -1, -1};
+
+// Smoothstep on a Q8 fraction: 3f^2 - 2f^3
+static inline uint8_t fade8(uint8_t f) {
+    return ((uint32_t)f * f * (768 - 2 * (uint32_t)f)) >> 16;
+}
+
+static inline int16_t lerp16(int16_t a, int16_t b, uint8_t t) {
+    return a + (((int32_t)(b - a) * t) >> 8);
+}
+
+NoiseField::NoiseField()
+    : current(0), step(0), builtRows(0), primed(false),
+      cellShift(3), octaves(2), seed(1), updateUs(0) {
+    memset(planes, 0, sizeof(planes));
+    memset(field, 0, sizeof(field));
+    for (uint8_t o = 0; o < NOISE_MAX_OCTAVES; o++) cache[o].plane = INT32_MIN;
+}
+
+void NoiseField::configure(uint8_t cellSize, uint8_t octaveCount, uint16_t noiseSeed) {
+    cellShift = 1;
+    while ((1 << (cellShift + 1)) <= cellSize && (1 << (cellShift + 1)) <= TOTAL_SIZE) cellShift++;
+    octaves = constrain(octaveCount, 1, min((uint8_t)NOISE_MAX_OCTAVES, cellShift));
+    seed = noiseSeed;
+    for (uint8_t o = 0; o < NOISE_MAX_OCTAVES; o++) cache[o].plane = INT32_MIN;
+    primed = false;
+}
+
+uint8_t NoiseField::hashGradient(int16_t ix, int16_t iy, int32_t plane, uint8_t octave) const {
+    uint32_t h = (uint32_t)ix * 0x27D4EB2DUL ^ (uint32_t)iy * 0x165667B1UL ^
+                 (uint32_t)plane * 0x9E3779B1UL ^ ((uint32_t)seed << 8 | octave) * 0x85EBCA6BUL;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6DUL;
+    h ^= h >> 12;
+    return h & 7;
+}
+
+// Add one octave of noise plane 'plane', row y, into acc (octave o has amplitude 1/2^o)
+void NoiseField::perlinRow(int16_t* acc, int32_t plane, uint8_t y, uint8_t octave) {
+    uint8_t shift = cellShift - octave;
+    uint8_t mask = (1 << shift) - 1;
+    int16_t cellY = y >> shift;
+    uint8_t cols = (TOTAL_SIZE >> shift) + 1;
+
+    // Corner gradients are shared by every pixel row of a cell row
+    GradientCache& c = cache[octave];
+    if (c.plane != plane || c.cellY != cellY) {
+        for (uint8_t i = 0; i < cols; i++) {
+            uint8_t g0 = hashGradient(i, cellY, plane, octave);
+            uint8_t g1 = hashGradient(i, cellY + 1, plane, octave);
+            c.gx[0][i] = GRAD_X[g0];
+            c.gy[0][i] = GRAD_Y[g0];
+            c.gx[1][i] = GRAD_X[g1];
+            c.gy[1][i] = GRAD_Y[g1];
+        }
+        c.plane = plane;
+        c.cellY = cellY;
+    }
+
+    // Pixel centres as Q8 fractions of the cell
+    int16_t fy = (((y & mask) << 1) + 1) << (7 - shift);
+    uint8_t sy = fade8(fy);
+    uint8_t weight = 256 >> (octave + 1);   // 128, 64, 32
+
+    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+        uint8_t cx = x >> shift;
+        int16_t fx = (((x & mask) << 1) + 1) << (7 - shift);
+
+        int16_t d00 = c.gx[0][cx] * fx + c.gy[0][cx] * fy;
+        int16_t d10 = c.gx[0][cx + 1] * (fx - 256) + c.gy[0][cx + 1] * fy;
+        int16_t d01 = c.gx[1][cx] * fx + c.gy[1][cx] * (fy - 256);
+        int16_t d11 = c.gx[1][cx + 1] * (fx - 256) + c.gy[1][cx + 1] * (fy - 256);
+
+        uint8_t sx = fade8(fx);
+        int16_t n = lerp16(lerp16(d00, d10, sx), lerp16(d01, d11, sx), sy);
+        acc[x] += ((int32_t)n * weight) >> 7;
+    }
+}
+
+void NoiseField::buildRow(uint8_t slot, int32_t plane, uint8_t y) {
+    int16_t acc[TOTAL_SIZE];
+    memset(acc, 0, sizeof(acc));
+    for (uint8_t o = 0; o < octaves; o++) perlinRow(acc, plane, y, o);
+
+    // Octave amplitudes sum to at most 1.75; 5/8 maps the bulk of the range onto 0..255
+    uint8_t* out = planes[slot][y];
+    for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+        int16_t v = 128 + ((acc[x] * 5) >> 3);
+        out[x] = constrain(v, 0, 255);
+    }
+}
+
+void NoiseField::buildPlane(uint8_t slot, int32_t plane) {
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) buildRow(slot, plane, y);
+}
+
+void NoiseField::update(uint32_t time) {
+    uint32_t start = micros();
+    int32_t k = time >> 8;
+    uint8_t ft = time & 0xFF;
+
+    if (!primed || k < step || k > step + 1) {
+        // First frame or a jump in time: nothing to reuse
+        current = 0;
+        step = k;
+        buildPlane(0, k);
+        buildPlane(1, k + 1);
+        builtRows = 0;
+        primed = true;
+    } else if (k == step + 1) {
+        // Next time cell: the look-ahead plane becomes k+1
+        uint8_t ahead = (current + 2) % 3;
+        while (builtRows < TOTAL_SIZE) buildRow(ahead, step + 2, builtRows++);
+        current = (current + 1) % 3;
+        step = k;
+        builtRows = 0;
+    }
+
+    // Build plane k+2 in slices, keeping pace with progress through the cell
+    uint8_t ahead = (current + 2) % 3;
+    uint8_t target = (((uint16_t)ft + 1) * TOTAL_SIZE) >> 8;
+    while (builtRows < target) buildRow(ahead, step + 2, builtRows++);
+
+    const uint8_t (*a)[TOTAL_SIZE] = planes[current];
+    const uint8_t (*b)[TOTAL_SIZE] = planes[(current + 1) % 3];
+    uint8_t s = fade8(ft);
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            field[y][x] = lerp8by8(a[y][x], b[y][x], s);
+        }
+    }
+
+    updateUs = micros() - start;
+}
+
+void NoiseField::render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const Palette& palette, uint8_t offset) const {
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        const uint8_t* r = field[y];
+        CRGB* out = buffer[y];
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            out[x] = palette.lookup(r[x] + offset);
+        }
+    }
+}
+
+void NoiseField::benchmark(uint16_t frames) {
+    NoiseField* noise = new NoiseField();
+    uint8_t (*reference)[TOTAL_SIZE] = new uint8_t[TOTAL_SIZE][TOTAL_SIZE];
+    if (!noise || !reference) {
+        delete noise;
+        delete[] reference;
+        return;
+    }
+
+    // Same lattice for both: 8-pixel cells, one octave, time advancing 1/16 cell per frame
+    noise->configure(8, 1, 1);
+    uint32_t start = micros();
+    for (uint16_t f = 0; f < frames; f++) noise->update((uint32_t)f * 16);
+    uint32_t fieldUs = micros() - start;
+
+    start = micros();
+    for (uint16_t f = 0; f < frames; f++) {
+        for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+            for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+                reference[y][x] = inoise8(x << 5, y << 5, f * 16);
+            }
+        }
+    }
+    uint32_t inoiseUs = micros() - start;
+
+    // Mean of each field, so neither loop can be optimised away and a broken
+    // field (flat, or a different range) stands out
+    uint32_t fieldSum = 0, inoiseSum = 0;
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            fieldSum += noise->value(x, y);
+            inoiseSum += reference[y][x];
+        }
+    }
+
+    Serial.printf("Noise benchmark (%u frames): NoiseField %.2f us/frame, inoise8 %.2f us/frame (%.1fx)\n",
+                  frames, (float)fieldUs / frames, (float)inoiseUs / frames,
+                  fieldUs ? (float)inoiseUs / fieldUs : 0.0f);
+    Serial.printf("  mean value: NoiseField %lu, inoise8 %lu\n",
+                  (unsigned long)(fieldSum / (TOTAL_SIZE * TOTAL_SIZE)),
+                  (unsigned long)(inoiseSum / (TOTAL_SIZE * TOTAL_SIZE)));
+    delete noise;
+    delete[] reference;
+}
@@ -0,0 +1,58 @@
+#include "render/Palette.h"
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+
+bool Palette::loadFromJson(const char* path) {
+    File file = LittleFS.open(path, "r");
+    if (!file) {
+        Serial.printf("✗ Palette file not found: %s\n", path);
+        return false;
+    }
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+
+    if (error) {
+        Serial.printf("✗ Palette JSON parse error: %s\n", error.c_str());
+        return false;
+    }
+
+    if (doc["hsv"].is<JsonArray>()) {
+        JsonArray hsv = doc["hsv"];
+        if (hsv.size() < 4) {
+            Serial.printf("⚠ Palette 'hsv' needs 4 values: %s\n", path);
+            return false;
+        }
+        fromHsvRange(hsv[0].as<uint8_t>(), hsv[1].as<uint16_t>(), hsv[2].as<uint8_t>(), hsv[3].as<uint8_t>());
+        return true;
+    }
+
+    if (doc["stops"].is<JsonArray>()) {
+        JsonArray stops = doc["stops"];
+        GradientStop parsed[32];
+        uint8_t count = 0;
+        for (JsonArray stop : stops) {
+            if (count >= 32 || stop.size() < 4) break;
+            parsed[count].index = stop[0];
+            parsed[count].r = stop[1];
+            parsed[count].g = stop[2];
+            parsed[count].b = stop[3];
+            // Stops must be ascending
+            if (count > 0 && parsed[count].index <= parsed[count - 1].index) {
+                Serial.printf("⚠ Palette stops out of order: %s\n", path);
+                return false;
+            }
+            count++;
+        }
+        if (count == 0 || parsed[0].index != 0 || parsed[count - 1].index != 255) {
+            Serial.printf("⚠ Palette stops must span 0..255: %s\n", path);
+            return false;
+        }
+        fromGradient(parsed, count);
+        return true;
+    }
+
+    Serial.printf("⚠ Palette file has neither 'hsv' nor 'stops': %s\n", path);
+    return false;
+}
@@ -0,0 +1,221 @@
+#include "render/PixelShader.h"
+#include <LittleFS.h>
+
+// Inputs a segment may read, for validation
+#define INPUT_X 0x01
+#define INPUT_Y 0x02
+#define INPUT_T 0x04
+
+PixelShader::PixelShader()
+    : frameLen(0), rowLen(0), pixelLen(0), regCount(0), symmetry(SYMMETRY_NONE), valid(false) {
+    memset(code, 0, sizeof(code));
+    memset(table, 0, sizeof(table));
+}
+
+bool PixelShader::load(const char* path) {
+    File f = LittleFS.open(path, "r");
+    if (!f) {
+        Serial.printf("✗ Shader not found: %s\n", path);
+        return false;
+    }
+
+    size_t size = f.size();
+    const size_t maxSize = sizeof(ShaderHeader) + 255 * 4 + sizeof(table) + SHADER_MAX_CODE;
+    if (size < sizeof(ShaderHeader) || size > maxSize) {
+        Serial.printf("✗ Shader has invalid size (%u bytes): %s\n", (unsigned)size, path);
+        f.close();
+        return false;
+    }
+
+    uint8_t* data = (uint8_t*)malloc(size);
+    if (!data) {
+        f.close();
+        return false;
+    }
+    size_t n = f.read(data, size);
+    f.close();
+
+    bool ok = n == size && loadFromMemory(data, size);
+    free(data);
+    if (!ok) Serial.printf("✗ Invalid shader program: %s\n", path);
+    return ok;
+}
+
+bool PixelShader::loadFromMemory(const uint8_t* data, size_t size) {
+    valid = false;
+    if (size < sizeof(ShaderHeader)) return false;
+
+    ShaderHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (strncmp(header.magic, "PSH1", 4) != 0) return false;
+    if (header.regCount > SHADER_MAX_REGS) return false;
+
+    uint8_t sym = (header.flags & SHADER_SYMMETRY_MASK) >> SHADER_SYMMETRY_SHIFT;
+    if (sym != SYMMETRY_NONE && sym != SYMMETRY_HORIZONTAL && sym != SYMMETRY_VERTICAL &&
+        sym != SYMMETRY_4FOLD && sym != SYMMETRY_8FOLD) return false;
+
+    size_t codeLen = (size_t)header.frameLen + header.rowLen + header.pixelLen;
+    size_t tableLen = (header.flags & SHADER_FLAG_TABLE) ? sizeof(table) : 0;
+    size_t stopsLen = (size_t)header.stopCount * sizeof(GradientStop);
+    if (codeLen > SHADER_MAX_CODE || header.pixelLen == 0) return false;
+    if (sizeof(header) + stopsLen + tableLen + codeLen != size) return false;
+
+    const uint8_t* p = data + sizeof(header);
+
+    // Palette: gradient stops, or the rainbow hue wheel by default
+    if (header.stopCount > 0) {
+        GradientStop stops[255];
+        memcpy(stops, p, stopsLen);
+        palette.fromGradient(stops, header.stopCount);
+        p += stopsLen;
+    } else {
+        palette.fromHsvRange(0, 256, 255, 255);
+    }
+
+    if (tableLen) {
+        memcpy(table, p, tableLen);
+        p += tableLen;
+    } else {
+        memset(table, 0, sizeof(table));
+    }
+
+    memcpy(code, p, codeLen);
+    frameLen = header.frameLen;
+    rowLen = header.rowLen;
+    pixelLen = header.pixelLen;
+    regCount = header.regCount;
+    symmetry = (RenderSymmetry)sym;
+
+    // Validate once so the interpreter loop can skip all checks
+    valid = validateSegment(code, frameLen, INPUT_T, 0) &&
+            validateSegment(code + frameLen, rowLen, INPUT_T | INPUT_Y, 0) &&
+            validateSegment(code + frameLen + rowLen, pixelLen, INPUT_T | INPUT_Y | INPUT_X, 1);
+    return valid;
+}
+
+bool PixelShader::validateSegment(const uint8_t* seg, uint16_t len, uint8_t allowedInputs, uint8_t resultDepth) const {
+    int depth = 0;
+    uint16_t pc = 0;
+
+    while (pc < len) {
+        uint8_t op = seg[pc++];
+        int pops = 0;
+        int pushes = 1;
+
+        switch (op) {
+            case OP_CONST:
+                if (pc + 4 > len) return false;
+                pc += 4;
+                break;
+            case OP_X: if (!(allowedInputs & INPUT_X)) return false; break;
+            case OP_Y: if (!(allowedInputs & INPUT_Y)) return false; break;
+            case OP_T: if (!(allowedInputs & INPUT_T)) return false; break;
+            case OP_LOAD:
+            case OP_STORE:
+                if (pc + 1 > len || seg[pc] >= regCount) return false;
+                pc++;
+                if (op == OP_STORE) { pops = 1; pushes = 0; }
+                break;
+            case OP_ADD: case OP_SUB: case OP_MUL: case OP_DIV: case OP_MOD:
+            case OP_MIN: case OP_MAX: case OP_NOISE2:
+                pops = 2;
+                break;
+            case OP_NOISE3:
+                pops = 3;
+                break;
+            case OP_NEG: case OP_ABS: case OP_FRAC: case OP_SIN: case OP_COS: case OP_LUT:
+                pops = 1;
+                break;
+            default:
+                return false;
+        }
+
+        if (depth < pops) return false;
+        depth += pushes - pops;
+        if (depth > SHADER_STACK_SIZE) return false;
+    }
+
+    return depth == resultDepth;
+}
+
+int32_t PixelShader::run(const uint8_t* seg, uint16_t len, int32_t* regs, int32_t x, int32_t y, int32_t t) const {
+    int32_t stack[SHADER_STACK_SIZE];
+    int32_t* sp = stack;   // points one past the top
+    const uint8_t* pc = seg;
+    const uint8_t* end = seg + len;
+
+    while (pc < end) {
+        switch (*pc++) {
+            case OP_CONST: {
+                int32_t v;
+                memcpy(&v, pc, 4);
+                pc += 4;
+                *sp++ = v;
+                break;
+            }
+            case OP_X: *sp++ = x; break;
+            case OP_Y: *sp++ = y; break;
+            case OP_T: *sp++ = t; break;
+            case OP_LOAD: *sp++ = regs[*pc++]; break;
+            case OP_STORE: regs[*pc++] = *--sp; break;
+            case OP_ADD: sp--; sp[-1] += sp[0]; break;
+            case OP_SUB: sp--; sp[-1] -= sp[0]; break;
+            case OP_MUL: sp--; sp[-1] = (int32_t)(((int64_t)sp[-1] * sp[0]) >> 8); break;
+            case OP_DIV:
+                sp--;
+                sp[-1] = sp[0] ? (int32_t)(((int64_t)sp[-1] << 8) / sp[0]) : 0;
+                break;
+            case OP_MOD:
+                sp--;
+                sp[-1] = sp[0] ? sp[-1] % sp[0] : 0;
+                break;
+            case OP_NEG: sp[-1] = -sp[-1]; break;
+            case OP_MIN: sp--; if (sp[0] < sp[-1]) sp[-1] = sp[0]; break;
+            case OP_MAX: sp--; if (sp[0] > sp[-1]) sp[-1] = sp[0]; break;
+            case OP_ABS: if (sp[-1] < 0) sp[-1] = -sp[-1]; break;
+            case OP_FRAC: sp[-1] &= 0xFF; break;
+            case OP_SIN: sp[-1] = sin16((uint16_t)(sp[-1] << 8)) >> 7; break;
+            case OP_COS: sp[-1] = cos16((uint16_t)(sp[-1] << 8)) >> 7; break;
+            case OP_NOISE2:
+                sp--;
+                sp[-1] = inoise8((uint16_t)sp[-1], (uint16_t)sp[0]);
+                break;
+            case OP_NOISE3:
+                sp -= 2;
+                sp[-1] = inoise8((uint16_t)sp[-1], (uint16_t)sp[0], (uint16_t)sp[1]);
+                break;
+            case OP_LUT: sp[-1] = table[(sp[-1] >> 8) & 0xFF]; break;
+        }
+    }
+
+    return sp > stack ? sp[-1] : 0;
+}
+
+void PixelShader::renderRows(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint32_t frameTime,
+                             uint8_t yStart, uint8_t yEnd, uint8_t width, uint8_t scale,
+                             bool upperTriangle) const {
+    if (!valid) return;
+
+    int32_t regs[SHADER_MAX_REGS];
+    memset(regs, 0, sizeof(regs));
+    int32_t t = (int32_t)(((uint64_t)frameTime << 8) / 1000);
+    int32_t step = (int32_t)scale << 8;
+    const uint8_t* rowCode = code + frameLen;
+    const uint8_t* pixelCode = rowCode + rowLen;
+
+    run(code, frameLen, regs, 0, 0, t);
+
+    for (uint8_t y = yStart; y < yEnd; y++) {
+        int32_t fy = y * step;
+        run(rowCode, rowLen, regs, 0, fy, t);
+
+        CRGB* row = buffer[y];
+        uint8_t xStart = upperTriangle ? y : 0;
+        int32_t fx = xStart * step;
+        for (uint8_t x = xStart; x < width; x++) {
+            int32_t pos = run(pixelCode, pixelLen, regs, fx, fy, t);
+            row[x] = palette.sample((uint16_t)pos);
+            fx += step;
+        }
+    }
+}
@@ -0,0 +1,188 @@
+#include "render/PostProcessor.h"
+
+PostProcessor::PostProcessor() : levelsBrightness(255), levelsContrast(128) {
+    buildLevels(levelsBrightness, levelsContrast);
+    reset();
+}
+
+void PostProcessor::reset() {
+    memset(history, 0, sizeof(history));
+    memset(passUs, 0, sizeof(passUs));
+}
+
+void PostProcessor::buildLevels(uint8_t brightness, uint8_t contrast) {
+    for (uint16_t v = 0; v < 256; v++) {
+        int16_t c = 128 + (((int16_t)v - 128) * contrast) / 128;
+        c = constrain(c, 0, 255);
+        levels[v] = (c * (brightness + 1)) >> 8;
+    }
+    levelsBrightness = brightness;
+    levelsContrast = contrast;
+}
+
+CRGB (*PostProcessor::apply(CRGB source[TOTAL_SIZE][TOTAL_SIZE], const PostPass* passes, uint8_t count,
+                            uint8_t width, uint8_t height))[TOTAL_SIZE] {
+    memset(passUs, 0, sizeof(passUs));
+    if (count == 0) return source;
+    if (count > MAX_POST_PASSES) count = MAX_POST_PASSES;
+
+    size_t rowBytes = width * sizeof(CRGB);
+    bool copied = false;
+    uint8_t i = 0;
+
+    while (i < count) {
+        uint32_t start = micros();
+
+        if (isRowLocal(passes[i])) {
+            // Fuse the run of row-local passes (and the initial copy) into one sweep
+            uint8_t end = i;
+            while (end < count && isRowLocal(passes[end])) end++;
+
+            for (uint8_t y = 0; y < height; y++) {
+                CRGB* row = output[y];
+                if (!copied) memcpy(row, source[y], rowBytes);
+                for (uint8_t k = i; k < end; k++) applyRow(passes[k], row, y, width);
+            }
+            copied = true;
+            passUs[i] = micros() - start;
+            i = end;
+            continue;
+        }
+
+        if (!copied) {
+            for (uint8_t y = 0; y < height; y++) memcpy(output[y], source[y], rowBytes);
+            copied = true;
+        }
+
+        const PostPass& pass = passes[i];
+        switch (pass.type) {
+            case POST_BLUR:
+                blur(constrain(pass.p0, 1, 3), pass.p1 != 0, width, height);
+                break;
+            case POST_MIRROR:
+                if (pass.p0 & POST_MIRROR_H) {
+                    for (uint8_t y = 0; y < height; y++) applyRow(pass, output[y], y, width);
+                }
+                if (pass.p0 & POST_MIRROR_V) mirrorRows(width, height);
+                break;
+            case POST_KALEIDOSCOPE:
+                kaleidoscope(width, height);
+                break;
+            default:
+                break;
+        }
+        passUs[i] = micros() - start;
+        i++;
+    }
+
+    return output;
+}
+
+void PostProcessor::applyRow(const PostPass& pass, CRGB* row, uint8_t y, uint8_t width) {
+    switch (pass.type) {
+        case POST_TRAILS: {
+            // Keep the brighter of the new pixel and the faded previous output
+            CRGB* hist = history[y];
+            uint8_t keep = 255 - pass.p0;
+            for (uint8_t x = 0; x < width; x++) {
+                CRGB faded = hist[x];
+                faded.nscale8(keep);
+                CRGB& c = row[x];
+                if (faded.r > c.r) c.r = faded.r;
+                if (faded.g > c.g) c.g = faded.g;
+                if (faded.b > c.b) c.b = faded.b;
+                hist[x] = c;
+            }
+            break;
+        }
+        case POST_LEVELS:
+            if (pass.p0 != levelsBrightness || pass.p1 != levelsContrast) buildLevels(pass.p0, pass.p1);
+            for (uint8_t x = 0; x < width; x++) {
+                row[x].r = levels[row[x].r];
+                row[x].g = levels[row[x].g];
+                row[x].b = levels[row[x].b];
+            }
+            break;
+        case POST_MIRROR:
+            for (uint8_t x = 0; x < width / 2; x++) row[width - 1 - x] = row[x];
+            break;
+        default:
+            break;
+    }
+}
+
+// Horizontal pass of the blur, from one row into another
+static void blurRow(const CRGB* in, CRGB* out, uint8_t width, uint8_t radius,
+                    const uint8_t* weights, uint32_t norm) {
+    uint8_t taps = 2 * radius + 1;
+    for (uint8_t x = 0; x < width; x++) {
+        uint16_t r = 0, g = 0, b = 0;
+        for (uint8_t k = 0; k < taps; k++) {
+            int16_t sx = constrain((int16_t)x + k - radius, 0, width - 1);
+            r += weights[k] * in[sx].r;
+            g += weights[k] * in[sx].g;
+            b += weights[k] * in[sx].b;
+        }
+        out[x] = CRGB((r * norm + 32768) >> 16, (g * norm + 32768) >> 16, (b * norm + 32768) >> 16);
+    }
+}
+
+// Separable blur in one top-to-bottom sweep: rows are blurred horizontally into a
+// ring just before the vertical pass needs them, so the output can be written in
+// place once a row's input is no longer referenced.
+void PostProcessor::blur(uint8_t radius, bool gaussian, uint8_t width, uint8_t height) {
+    static const uint8_t binomial[3][7] = {
+        {1, 2, 1}, {1, 4, 6, 4, 1}, {1, 6, 15, 20, 15, 6, 1}
+    };
+    uint8_t taps = 2 * radius + 1;
+    uint8_t weights[7];
+    for (uint8_t k = 0; k < taps; k++) weights[k] = gaussian ? binomial[radius - 1][k] : 1;
+    // Q16 reciprocal of the kernel sum
+    uint32_t norm = gaussian ? (65536UL >> (2 * radius)) : (65536UL + taps / 2) / taps;
+
+    CRGB ring[8][TOTAL_SIZE];   // Horizontally blurred rows, indexed by row & 7
+    int16_t ready = -1;         // Last row in the ring
+
+    for (uint8_t y = 0; y < height; y++) {
+        int16_t need = min((int16_t)(y + radius), (int16_t)(height - 1));
+        while (ready < need) {
+            ready++;
+            blurRow(output[ready], ring[ready & 7], width, radius, weights, norm);
+        }
+
+        CRGB* out = output[y];
+        for (uint8_t x = 0; x < width; x++) {
+            uint16_t r = 0, g = 0, b = 0;
+            for (uint8_t k = 0; k < taps; k++) {
+                int16_t sy = constrain((int16_t)y + k - radius, 0, height - 1);
+                const CRGB& c = ring[sy & 7][x];
+                r += weights[k] * c.r;
+                g += weights[k] * c.g;
+                b += weights[k] * c.b;
+            }
+            out[x] = CRGB((r * norm + 32768) >> 16, (g * norm + 32768) >> 16, (b * norm + 32768) >> 16);
+        }
+    }
+}
+
+void PostProcessor::mirrorRows(uint8_t width, uint8_t height) {
+    for (uint8_t y = 0; y < height / 2; y++) {
+        memcpy(output[height - 1 - y], output[y], width * sizeof(CRGB));
+    }
+}
+
+// 4-way rotational symmetry: the top-left quadrant is copied into the other
+// three rotated by 90, 180 and 270 degrees about the centre. (A horizontal plus
+// vertical mirror gives the reflective variant.)
+void PostProcessor::kaleidoscope(uint8_t width, uint8_t height) {
+    uint8_t size = min(width, height);
+    uint8_t half = size / 2;
+    for (uint8_t y = 0; y < half; y++) {
+        for (uint8_t x = 0; x < half; x++) {
+            CRGB c = output[y][x];
+            output[x][size - 1 - y] = c;
+            output[size - 1 - y][size - 1 - x] = c;
+            output[size - 1 - x][y] = c;
+        }
+    }
+}
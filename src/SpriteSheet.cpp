@@ -0,0 +1,142 @@
+#include "render/SpriteSheet.h"
+#include <LittleFS.h>
+
+static inline uint16_t readU16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static inline uint32_t readU32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool SpriteSheet::load(const char* path) {
+    release();
+
+    File f = LittleFS.open(path, "r");
+    if (!f) {
+        Serial.printf("✗ Sprite sheet not found: %s\n", path);
+        return false;
+    }
+
+    size_t fileSize = f.size();
+    if (fileSize < sizeof(SpriteSheetHeader)) {
+        Serial.printf("✗ Sprite sheet too small (%u bytes): %s\n", (unsigned)fileSize, path);
+        f.close();
+        return false;
+    }
+
+    uint8_t* buffer = (uint8_t*)malloc(fileSize);
+    if (!buffer) {
+        Serial.printf("✗ Out of memory loading sprite sheet: %s\n", path);
+        f.close();
+        return false;
+    }
+    size_t n = f.read(buffer, fileSize);
+    f.close();
+
+    if (n != fileSize || !loadFromMemory(buffer, fileSize)) {
+        Serial.printf("✗ Invalid sprite sheet: %s\n", path);
+        free(buffer);
+        return false;
+    }
+    ownsData = true;
+    return true;
+}
+
+bool SpriteSheet::loadFromMemory(const uint8_t* sheet, size_t sheetSize) {
+    release();
+    if (sheetSize < sizeof(SpriteSheetHeader)) return false;
+
+    memcpy(&header, sheet, sizeof(header));
+    data = sheet;
+    size = sheetSize;
+    if (!validate()) {
+        data = nullptr;
+        size = 0;
+        memset(&header, 0, sizeof(header));
+        return false;
+    }
+    return true;
+}
+
+void SpriteSheet::release() {
+    if (ownsData && data) free((void*)data);
+    data = nullptr;
+    size = 0;
+    ownsData = false;
+    memset(&header, 0, sizeof(header));
+}
+
+// Walk every row of every frame once, so blit() can trust offsets and lengths
+bool SpriteSheet::validate() const {
+    if (strncmp(header.magic, "SPR1", 4) != 0) return false;
+    if (header.frameWidth == 0 || header.frameHeight == 0 || header.frameCount == 0) return false;
+
+    size_t tableEnd = sizeof(SpriteSheetHeader) + (size_t)header.frameCount * 4;
+    if (tableEnd > size) return false;
+
+    for (uint16_t frame = 0; frame < header.frameCount; frame++) {
+        size_t frameStart = readU32(data + sizeof(SpriteSheetHeader) + frame * 4);
+        if (frameStart < tableEnd || frameStart + (size_t)header.frameHeight * 2 > size) return false;
+
+        for (uint16_t row = 0; row < header.frameHeight; row++) {
+            size_t p = frameStart + readU16(data + frameStart + row * 2);
+            if (p >= size) return false;
+            uint8_t spans = data[p++];
+            uint32_t width = 0;
+            for (uint8_t s = 0; s < spans; s++) {
+                if (p + 2 > size) return false;
+                uint8_t skip = data[p];
+                uint8_t len = data[p + 1];
+                p += 2;
+                uint8_t count = len & SPRITE_SPAN_LENGTH;
+                size_t payload = (len & SPRITE_SPAN_SOLID) ? 3 : (size_t)count * 3;
+                if (count == 0 || p + payload > size) return false;
+                p += payload;
+                width += skip + count;
+            }
+            if (width > header.frameWidth) return false;
+        }
+    }
+    return true;
+}
+
+void SpriteSheet::blit(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], uint16_t frame, int16_t x, int16_t y) const {
+    if (!data || frame >= header.frameCount) return;
+
+    // Rows and columns of the frame that land on the canvas
+    int16_t rowStart = y < 0 ? -y : 0;
+    int16_t rowEnd = min((int16_t)header.frameHeight, (int16_t)(TOTAL_SIZE - y));
+    if (rowStart >= rowEnd || x >= TOTAL_SIZE || x + (int16_t)header.frameWidth <= 0) return;
+
+    const uint8_t* frameData = data + readU32(data + sizeof(SpriteSheetHeader) + frame * 4);
+
+    for (int16_t row = rowStart; row < rowEnd; row++) {
+        const uint8_t* p = frameData + readU16(frameData + row * 2);
+        CRGB* out = buffer[y + row];
+        uint8_t spans = *p++;
+        int16_t dx = x;
+
+        for (uint8_t s = 0; s < spans; s++) {
+            dx += p[0];
+            uint8_t len = p[1];
+            p += 2;
+            uint8_t count = len & SPRITE_SPAN_LENGTH;
+
+            // Clip the span to [0, TOTAL_SIZE)
+            int16_t first = dx < 0 ? -dx : 0;
+            int16_t last = min((int16_t)count, (int16_t)(TOTAL_SIZE - dx));
+
+            if (len & SPRITE_SPAN_SOLID) {
+                if (first < last) {
+                    CRGB c(p[0], p[1], p[2]);
+                    for (int16_t i = first; i < last; i++) out[dx + i] = c;
+                }
+                p += 3;
+            } else {
+                if (first < last) memcpy(&out[dx + first], p + first * 3, (last - first) * 3);
+                p += count * 3;
+            }
+
+            dx += count;
+            if (dx >= TOTAL_SIZE) break;   // Rest of the row is off-canvas
+        }
+    }
+}
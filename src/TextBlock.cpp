@@ -0,0 +1,143 @@
+#include "render/TextBlock.h"
+
+void TextBlock::findBreak(BitmapFont& font, const char* start, uint8_t maxWidth,
+                          const char*& end, const char*& resume) {
+    const char* breakEnd = nullptr;     // Last place the line may end so far
+    const char* breakResume = nullptr;
+
+    GlyphCursor cursor(start);
+    while (*cursor.next) {
+        const char* at = cursor.next;
+        if (*at == '\n') {
+            end = at;
+            resume = at + 1;
+            return;
+        }
+
+        int32_t left;
+        const FontGlyph* g = font.nextGlyph(cursor, left);
+        if (!g) break;
+
+        // Spaces may hang past the edge; they are trimmed from the line
+        bool space = *at == ' ';
+        bool overflow = !space && (left + g->width > maxWidth || cursor.next - start >= TEXT_BLOCK_LINE_BYTES);
+        if (overflow && at != start) {
+            if (breakEnd) {
+                end = breakEnd;
+                resume = breakResume;
+            } else {
+                // A single word wider than the line: break it here
+                end = at;
+                resume = at;
+            }
+            while (*resume == ' ') resume++;
+            return;
+        }
+
+        if (space) {
+            breakEnd = at;
+            breakResume = cursor.next;
+        } else if (*at == '-' && *cursor.next && *cursor.next != ' ') {
+            breakEnd = cursor.next;
+            breakResume = cursor.next;
+        }
+    }
+    end = cursor.next;
+    resume = cursor.next;
+}
+
+bool TextBlock::layout(BitmapFont& newFont, const char* newText, uint8_t maxWidth, TextAlign align, uint8_t lineSpacing) {
+    font = &newFont;
+    fontGeneration = newFont.getGeneration();
+    spacing = lineSpacing;
+    lineHeight = newFont.getHeight() + lineSpacing;
+    lineCount = 0;
+    truncated = false;
+    for (uint8_t i = 0; i < TEXT_BLOCK_STRIPS; i++) stripLine[i] = -1;
+
+    size_t textLength = strlen(newText);
+    char* copy = (char*)realloc(text, textLength + 1);
+    if (!copy) {
+        truncated = true;
+        return false;
+    }
+    text = copy;
+    memmove(text, newText, textLength + 1);
+
+    char lineText[TEXT_BLOCK_LINE_BYTES];
+    const char* p = text;
+    while (*p) {
+        if (lineCount == lineCapacity) {
+            uint16_t grownCapacity = lineCapacity == 0 ? 16 : (lineCapacity > 0x7FFF ? 0xFFFF : lineCapacity * 2);
+            Line* grown = grownCapacity > lineCapacity ? (Line*)realloc(lines, grownCapacity * sizeof(Line)) : nullptr;
+            if (!grown) {
+                truncated = true;
+                return false;
+            }
+            lines = grown;
+            lineCapacity = grownCapacity;
+        }
+
+        const char* end;
+        const char* resume;
+        findBreak(newFont, p, maxWidth, end, resume);
+        while (end > p && end[-1] == ' ') end--;
+        size_t length = end - p;
+        if (length > TEXT_BLOCK_LINE_BYTES - 1) length = TEXT_BLOCK_LINE_BYTES - 1;
+        memcpy(lineText, p, length);
+        lineText[length] = '\0';
+
+        Line& line = lines[lineCount++];
+        line.start = p - text;
+        line.length = length;
+        int16_t slack = (int16_t)maxWidth - (int16_t)newFont.getTextWidth(lineText);
+        line.x = align == ALIGN_CENTER ? slack / 2 : (align == ALIGN_RIGHT ? slack : 0);
+        p = resume;
+    }
+    return true;
+}
+
+const TextStrip& TextBlock::strip(uint16_t i) {
+    // A reloaded font invalidates every strip
+    if (font->getGeneration() != fontGeneration) {
+        fontGeneration = font->getGeneration();
+        for (uint8_t s = 0; s < TEXT_BLOCK_STRIPS; s++) stripLine[s] = -1;
+    }
+
+    uint8_t slot = i % TEXT_BLOCK_STRIPS;
+    if (stripLine[slot] != i) {
+        char lineText[TEXT_BLOCK_LINE_BYTES];
+        memcpy(lineText, text + lines[i].start, lines[i].length);
+        lineText[lines[i].length] = '\0';
+        stripLine[slot] = strips[slot].rasterize(*font, lineText) ? i : -1;
+    }
+    return strips[slot];
+}
+
+void TextBlock::render(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], int32_t top, CRGB fg, CRGB bg,
+                       uint16_t first, uint16_t count) {
+    bool covered[TOTAL_SIZE] = {};   // Canvas rows written by a line
+    uint32_t last = (uint32_t)first + count < lineCount ? (uint32_t)first + count : lineCount;
+    uint32_t i = first;
+    int h = lineHeight - spacing;
+
+    // Lines wholly above the canvas are skipped without being rasterized
+    if (top < 0 && lineHeight) i += (uint32_t)(-top) / lineHeight;
+    for (; i < last; i++) {
+        int32_t y = top + (int32_t)(i - first) * lineHeight;
+        if (y >= TOTAL_SIZE) break;
+        if (y + h <= 0) continue;
+
+        strip(i).render(buffer, lines[i].x, y, fg, bg);
+        int rowStart = y < 0 ? 0 : y;
+        int rowEnd = y + h < TOTAL_SIZE ? y + h : TOTAL_SIZE;
+        for (int r = rowStart; r < rowEnd; r++) covered[r] = true;
+    }
+
+    for (uint16_t y = 0; y < TOTAL_SIZE; y++) {
+        if (covered[y]) continue;
+        for (uint16_t x = 0; x < TOTAL_SIZE; x++) {
+            buffer[y][x] = bg;
+        }
+    }
+}
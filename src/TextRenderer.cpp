@@ -0,0 +1,356 @@
+#include "TextRenderer.h"
+
+// Font data - 5x7 bitmap font
+const uint8_t TextRenderer::fontData[FONT_ASCII_GLYPHS + FONT_EXTRA_GLYPHS][5] = {
+    // Space (32)
+    {0x00, 0x00, 0x00, 0x00, 0x00},
+    // ! (33)
+    {0x00, 0x00, 0x5F, 0x00, 0x00},
+    // " (34)
+    {0x00, 0x07, 0x00, 0x07, 0x00},
+    // # (35)
+    {0x14, 0x7F, 0x14, 0x7F, 0x14},
+    // $ (36)
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12},
+    // % (37)
+    {0x23, 0x13, 0x08, 0x64, 0x62},
+    // & (38)
+    {0x36, 0x49, 0x55, 0x22, 0x50},
+    // ' (39)
+    {0x00, 0x05, 0x03, 0x00, 0x00},
+    // ( (40)
+    {0x00, 0x1C, 0x22, 0x41, 0x00},
+    // ) (41)
+    {0x00, 0x41, 0x22, 0x1C, 0x00},
+    // * (42)
+    {0x14, 0x08, 0x3E, 0x08, 0x14},
+    // + (43)
+    {0x08, 0x08, 0x3E, 0x08, 0x08},
+    // , (44)
+    {0x00, 0x50, 0x30, 0x00, 0x00},
+    // - (45)
+    {0x08, 0x08, 0x08, 0x08, 0x08},
+    // . (46)
+    {0x00, 0x60, 0x60, 0x00, 0x00},
+    // / (47)
+    {0x20, 0x10, 0x08, 0x04, 0x02},
+    // 0 (48)
+    {0x3E, 0x51, 0x49, 0x45, 0x3E},
+    // 1 (49)
+    {0x00, 0x42, 0x7F, 0x40, 0x00},
+    // 2 (50)
+    {0x42, 0x61, 0x51, 0x49, 0x46},
+    // 3 (51)
+    {0x21, 0x41, 0x45, 0x4B, 0x31},
+    // 4 (52)
+    {0x18, 0x14, 0x12, 0x7F, 0x10},
+    // 5 (53)
+    {0x27, 0x45, 0x45, 0x45, 0x39},
+    // 6 (54)
+    {0x3C, 0x4A, 0x49, 0x49, 0x30},
+    // 7 (55)
+    {0x01, 0x71, 0x09, 0x05, 0x03},
+    // 8 (56)
+    {0x36, 0x49, 0x49, 0x49, 0x36},
+    // 9 (57)
+    {0x06, 0x49, 0x49, 0x29, 0x1E},
+    // : (58)
+    {0x00, 0x36, 0x36, 0x00, 0x00},
+    // ; (59)
+    {0x00, 0x56, 0x36, 0x00, 0x00},
+    // < (60)
+    {0x08, 0x14, 0x22, 0x41, 0x00},
+    // = (61)
+    {0x14, 0x14, 0x14, 0x14, 0x14},
+    // > (62)
+    {0x00, 0x41, 0x22, 0x14, 0x08},
+    // ? (63)
+    {0x02, 0x01, 0x51, 0x09, 0x06},
+    // @ (64)
+    {0x32, 0x49, 0x79, 0x41, 0x3E},
+    // A (65)
+    {0x7E, 0x11, 0x11, 0x11, 0x7E},
+    // B (66)
+    {0x7F, 0x49, 0x49, 0x49, 0x36},
+    // C (67)
+    {0x3E, 0x41, 0x41, 0x41, 0x22},
+    // D (68)
+    {0x7F, 0x41, 0x41, 0x22, 0x1C},
+    // E (69)
+    {0x7F, 0x49, 0x49, 0x49, 0x41},
+    // F (70)
+    {0x7F, 0x09, 0x09, 0x09, 0x01},
+    // G (71)
+    {0x3E, 0x41, 0x49, 0x49, 0x7A},
+    // H (72)
+    {0x7F, 0x08, 0x08, 0x08, 0x7F},
+    // I (73)
+    {0x00, 0x41, 0x7F, 0x41, 0x00},
+    // J (74)
+    {0x20, 0x40, 0x41, 0x3F, 0x01},
+    // K (75)
+    {0x7F, 0x08, 0x14, 0x22, 0x41},
+    // L (76)
+    {0x7F, 0x40, 0x40, 0x40, 0x40},
+    // M (77)
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F},
+    // N (78)
+    {0x7F, 0x04, 0x08, 0x10, 0x7F},
+    // O (79)
+    {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    // P (80)
+    {0x7F, 0x09, 0x09, 0x09, 0x06},
+    // Q (81)
+    {0x3E, 0x41, 0x51, 0x21, 0x5E},
+    // R (82)
+    {0x7F, 0x09, 0x19, 0x29, 0x46},
+    // S (83)
+    {0x46, 0x49, 0x49, 0x49, 0x31},
+    // T (84)
+    {0x01, 0x01, 0x7F, 0x01, 0x01},
+    // U (85)
+    {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    // V (86)
+    {0x1F, 0x20, 0x40, 0x20, 0x1F},
+    // W (87)
+    {0x3F, 0x40, 0x38, 0x40, 0x3F},
+    // X (88)
+    {0x63, 0x14, 0x08, 0x14, 0x63},
+    // Y (89)
+    {0x07, 0x08, 0x70, 0x08, 0x07},
+    // Z (90)
+    {0x61, 0x51, 0x49, 0x45, 0x43},
+    // [ (91)
+    {0x00, 0x7F, 0x41, 0x41, 0x00},
+    // \ (92)
+    {0x02, 0x04, 0x08, 0x10, 0x20},
+    // ] (93)
+    {0x00, 0x41, 0x41, 0x7F, 0x00},
+    // ^ (94)
+    {0x04, 0x02, 0x01, 0x02, 0x04},
+    // _ (95)
+    {0x40, 0x40, 0x40, 0x40, 0x40},
+    // ` (96)
+    {0x00, 0x01, 0x02, 0x04, 0x00},
+    // a (97)
+    {0x20, 0x54, 0x54, 0x54, 0x78},
+    // b (98)
+    {0x7F, 0x48, 0x44, 0x44, 0x38},
+    // c (99)
+    {0x38, 0x44, 0x44, 0x44, 0x20},
+    // d (100)
+    {0x38, 0x44, 0x44, 0x48, 0x7F},
+    // e (101)
+    {0x38, 0x54, 0x54, 0x54, 0x18},
+    // f (102)
+    {0x08, 0x7E, 0x09, 0x01, 0x02},
+    // g (103)
+    {0x0C, 0x52, 0x52, 0x52, 0x3E},
+    // h (104)
+    {0x7F, 0x08, 0x04, 0x04, 0x78},
+    // i (105)
+    {0x00, 0x44, 0x7D, 0x40, 0x00},
+    // j (106)
+    {0x20, 0x40, 0x44, 0x3D, 0x00},
+    // k (107)
+    {0x7F, 0x10, 0x28, 0x44, 0x00},
+    // l (108)
+    {0x00, 0x41, 0x7F, 0x40, 0x00},
+    // m (109)
+    {0x7C, 0x04, 0x18, 0x04, 0x78},
+    // n (110)
+    {0x7C, 0x08, 0x04, 0x04, 0x78},
+    // o (111)
+    {0x38, 0x44, 0x44, 0x44, 0x38},
+    // p (112)
+    {0x7C, 0x14, 0x14, 0x14, 0x08},
+    // q (113)
+    {0x08, 0x14, 0x14, 0x18, 0x7C},
+    // r (114)
+    {0x7C, 0x08, 0x04, 0x04, 0x08},
+    // s (115)
+    {0x48, 0x54, 0x54, 0x54, 0x20},
+    // t (116)
+    {0x04, 0x3F, 0x44, 0x40, 0x20},
+    // u (117)
+    {0x3C, 0x40, 0x40, 0x20, 0x7C},
+    // v (118)
+    {0x1C, 0x20, 0x40, 0x20, 0x1C},
+    // w (119)
+    {0x3C, 0x40, 0x30, 0x40, 0x3C},
+    // x (120)
+    {0x44, 0x28, 0x10, 0x28, 0x44},
+    // y (121)
+    {0x0C, 0x50, 0x50, 0x50, 0x3C},
+    // z (122)
+    {0x44, 0x64, 0x54, 0x4C, 0x44},
+    // { (123)
+    {0x00, 0x08, 0x36, 0x41, 0x00},
+    // | (124)
+    {0x00, 0x00, 0x7F, 0x00, 0x00},
+    // } (125)
+    {0x00, 0x41, 0x36, 0x08, 0x00},
+    // ~ (126)
+    {0x10, 0x08, 0x18, 0x10, 0x08},
+    // ¡ (U+00A1)
+    {0x00, 0x00, 0x7D, 0x00, 0x00},
+    // £ (U+00A3)
+    {0x48, 0x3E, 0x49, 0x41, 0x22},
+    // « (U+00AB)
+    {0x08, 0x14, 0x2A, 0x14, 0x22},
+    // ° (U+00B0)
+    {0x02, 0x05, 0x05, 0x02, 0x00},
+    // ± (U+00B1)
+    {0x44, 0x44, 0x5F, 0x44, 0x44},
+    // · (U+00B7)
+    {0x00, 0x00, 0x08, 0x00, 0x00},
+    // » (U+00BB)
+    {0x22, 0x14, 0x2A, 0x14, 0x08},
+    // ¿ (U+00BF)
+    {0x30, 0x48, 0x45, 0x40, 0x20},
+    // Ä (U+00C4)
+    {0x7D, 0x12, 0x12, 0x12, 0x7D},
+    // Ç (U+00C7)
+    {0x1E, 0x21, 0x61, 0x61, 0x12},
+    // É (U+00C9)
+    {0x7E, 0x4A, 0x4A, 0x4B, 0x42},
+    // Ö (U+00D6)
+    {0x3D, 0x42, 0x42, 0x42, 0x3D},
+    // Ü (U+00DC)
+    {0x3D, 0x40, 0x40, 0x40, 0x3D},
+    // ß (U+00DF)
+    {0x7E, 0x01, 0x45, 0x4A, 0x30},
+    // à (U+00E0)
+    {0x20, 0x55, 0x56, 0x54, 0x78},
+    // á (U+00E1)
+    {0x20, 0x54, 0x56, 0x55, 0x78},
+    // â (U+00E2)
+    {0x20, 0x56, 0x55, 0x56, 0x78},
+    // ä (U+00E4)
+    {0x20, 0x55, 0x54, 0x55, 0x78},
+    // ç (U+00E7)
+    {0x1C, 0x22, 0x62, 0x62, 0x10},
+    // è (U+00E8)
+    {0x38, 0x55, 0x56, 0x54, 0x18},
+    // é (U+00E9)
+    {0x38, 0x54, 0x56, 0x55, 0x18},
+    // ê (U+00EA)
+    {0x38, 0x56, 0x55, 0x56, 0x18},
+    // ë (U+00EB)
+    {0x38, 0x55, 0x54, 0x55, 0x18},
+    // ì (U+00EC)
+    {0x00, 0x45, 0x7E, 0x40, 0x00},
+    // í (U+00ED)
+    {0x00, 0x44, 0x7E, 0x41, 0x00},
+    // î (U+00EE)
+    {0x00, 0x46, 0x7D, 0x42, 0x00},
+    // ï (U+00EF)
+    {0x00, 0x45, 0x7C, 0x41, 0x00},
+    // ñ (U+00F1)
+    {0x7E, 0x09, 0x05, 0x06, 0x79},
+    // ò (U+00F2)
+    {0x38, 0x45, 0x46, 0x44, 0x38},
+    // ó (U+00F3)
+    {0x38, 0x44, 0x46, 0x45, 0x38},
+    // ô (U+00F4)
+    {0x38, 0x46, 0x45, 0x46, 0x38},
+    // ö (U+00F6)
+    {0x38, 0x45, 0x44, 0x45, 0x38},
+    // ù (U+00F9)
+    {0x3C, 0x41, 0x42, 0x20, 0x7C},
+    // ú (U+00FA)
+    {0x3C, 0x40, 0x42, 0x21, 0x7C},
+    // û (U+00FB)
+    {0x3C, 0x42, 0x41, 0x22, 0x7C},
+    // ü (U+00FC)
+    {0x3C, 0x41, 0x40, 0x21, 0x7C},
+    // € (U+20AC)
+    {0x14, 0x3E, 0x55, 0x55, 0x41}
+};
+
+const uint16_t TextRenderer::extraCodepoints[FONT_EXTRA_GLYPHS] = {
+    0x00A1, 0x00A3, 0x00AB, 0x00B0, 0x00B1, 0x00B7, 0x00BB, 0x00BF,
+    0x00C4, 0x00C7, 0x00C9, 0x00D6, 0x00DC, 0x00DF, 0x00E0, 0x00E1,
+    0x00E2, 0x00E4, 0x00E7, 0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC,
+    0x00ED, 0x00EE, 0x00EF, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F6,
+    0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x20AC
+};
+
+uint8_t TextRenderer::drawChar(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], char c, int x, int y, CRGB color) {
+    int charIndex = getCharIndex(c);
+    const uint8_t* charData = fontData[charIndex];
+
+    // Draw 5x7 character
+    for (int row = 0; row < FONT_HEIGHT; row++) {
+        for (int col = 0; col < FONT_WIDTH; col++) {
+            int bufferX = x + col;
+            int bufferY = y + row;
+
+            // Check bounds
+            if (bufferX >= 0 && bufferX < TOTAL_SIZE && bufferY >= 0 && bufferY < TOTAL_SIZE) {
+                // Check if bit is set in font data (one byte per column, bit 0 = top row)
+                if (charData[col] & (1 << row)) {
+                    buffer[bufferY][bufferX] = color;
+                }
+            }
+        }
+    }
+
+    return FONT_WIDTH + FONT_SPACING;
+}
+
+uint16_t TextRenderer::drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int x, int y, CRGB color) {
+    // The built-in font as a BitmapFont decodes UTF-8 and covers the extra glyphs
+    return drawText(buffer, BitmapFont::builtin(), text, x, y, color);
+}
+
+uint16_t TextRenderer::getTextWidth(const char* text) {
+    return BitmapFont::builtin().getTextWidth(text);
+}
+
+void TextRenderer::drawCenteredText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const char* text, int y, CRGB color) {
+    uint16_t textWidth = getTextWidth(text);
+    int startX = (TOTAL_SIZE - textWidth) / 2;
+    drawText(buffer, text, startX, y, color);
+}
+
+// Draw one glyph with its bitmap's first column at x
+static void drawGlyph(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], BitmapFont& font, const FontGlyph* glyph, int left, int y, CRGB color) {
+    if (left >= TOTAL_SIZE || left + glyph->width <= 0) return;
+    const uint8_t* bitmap = font.getGlyphBitmap(glyph);
+    for (int col = 0; col < glyph->width; col++) {
+        int bufferX = left + col;
+        if (bufferX < 0 || bufferX >= TOTAL_SIZE) continue;
+        for (int row = 0; row < font.getHeight(); row++) {
+            int bufferY = y + row;
+            if (bufferY < 0 || bufferY >= TOTAL_SIZE) continue;
+            uint8_t cov = font.coverage(bitmap, col, row);
+            if (cov == 15) buffer[bufferY][bufferX] = color;
+            else if (cov) nblend(buffer[bufferY][bufferX], color, cov * 17);
+        }
+    }
+}
+
+uint16_t TextRenderer::drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], BitmapFont& font, const char* text, int x, int y, CRGB color) {
+    GlyphCursor cursor(text, x);
+    int32_t left;
+    while (const FontGlyph* glyph = font.nextGlyph(cursor, left)) {
+        drawGlyph(buffer, font, glyph, left, y, color);
+    }
+    return cursor.pen - x;
+}
+
+uint16_t TextRenderer::drawText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], const TextLayout& layout, int x, int y, CRGB color) {
+    BitmapFont* font = layout.getFont();
+    if (!font) return 0;
+    for (uint16_t i = 0; i < layout.getCount(); i++) {
+        const LayoutGlyph& placed = layout[i];
+        drawGlyph(buffer, *font, placed.glyph, x + placed.x, y, color);
+    }
+    return layout.getAdvance();
+}
+
+void TextRenderer::drawCenteredText(CRGB buffer[TOTAL_SIZE][TOTAL_SIZE], BitmapFont& font, const char* text, int y, CRGB color) {
+    int startX = (TOTAL_SIZE - (int)font.getTextWidth(text)) / 2;
+    drawText(buffer, font, text, startX, y, color);
+}
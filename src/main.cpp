@@ -8,8 +8,23 @@
 #include "animations/SolidColorAnimation.h"
 #include "animations/FrameAnimation.h"
 #include "animations/TextAnimation.h"
+#include "animations/ParagraphAnimation.h"
+#include "animations/StopwatchAnimation.h"
+#include "animations/ShaderAnimation.h"
+#include "animations/ParticleAnimation.h"
+#include "animations/LifeAnimation.h"
+#include "animations/FireAnimation.h"
+#include "animations/SpriteAnimation.h"
+#include "animations/TransformAnimation.h"
+#include "animations/NoiseAnimation.h"
+#include "animations/AudioAnimation.h"
+#include "audio/I2SAudioSource.h"
+#include "audio/WavAudioSource.h"
 #include "frame_io/ProgmemFrameSource.h"
 #include "frame_io/FsFrameSource.h"
+#include "frame_io/ClipBaker.h"
+#include "frame_io/ClipPartition.h"
+#include "frame_io/MappedFrameSource.h"
 
 // LED Matrix Configuration - 4x 16x16 panels → 32x32 total
 // Hardware settings are now loaded from config file
@@ -93,6 +108,120 @@ void initializeLEDMatrix() {
   Serial.println("LED matrix ready!");
 }
 
+// Register user-defined shader effects found in /shaders (compiled with tools/shader_compile.py)
+void registerShaderAnimations() {
+  File dir = LittleFS.open("/shaders");
+  if (!dir || !dir.isDirectory()) return;
+
+  for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+    String fileName = f.name();
+    f.close();
+    if (!fileName.endsWith(".psb")) continue;
+
+    String path = String("/shaders/") + fileName;
+    String name = fileName.substring(0, fileName.length() - 4);
+    ShaderAnimation* shaderAnim = new ShaderAnimation(path.c_str(), name.c_str());
+    if (shaderAnim->isValid() && animManager.registerAnimation(shaderAnim)) {
+      Serial.printf("Shader animation registered: %s\n", name.c_str());
+    } else {
+      delete shaderAnim;
+    }
+  }
+}
+
+// Register the clips of the raw "clips" flash partition (written with tools/lfx_pack.py).
+// They play straight from the memory-mapped flash, without LittleFS.
+ClipPartition clipPartition;
+
+void registerPartitionClips() {
+  if (!clipPartition.begin()) return;
+
+  for (uint16_t i = 0; i < clipPartition.getCount(); i++) {
+    const ClipPackEntry& entry = clipPartition.getEntry(i);
+    MappedFrameSource* source = new MappedFrameSource(clipPartition.getClip(i), entry.size);
+    FrameAnimation* clipAnim = source->isValid() ? new FrameAnimation(source, entry.frameMs, entry.name) : nullptr;
+    if (clipAnim && animManager.registerAnimation(clipAnim)) {
+      Serial.printf("Partition clip registered: %s (%u frames)\n", entry.name, source->getFrameCount());
+    } else {
+      delete clipAnim;
+      delete source;
+    }
+  }
+}
+
+// Start the audio analyzer on the configured input and register the audio-reactive effects
+void registerAudioAnimations() {
+  String source = configManager.getAudioSource();
+  if (source.length() == 0) return;
+
+  IAudioSource* input;
+  if (source == "i2s") {
+    input = new I2SAudioSource(configManager.getAudioBckPin(), configManager.getAudioWsPin(),
+                               configManager.getAudioDataPin(), configManager.getAudioSampleRate());
+  } else {
+    input = new WavAudioSource(source.c_str());
+  }
+
+  AudioAnalyzer* analyzer = new AudioAnalyzer(input);
+  if (!analyzer->begin()) {
+    Serial.printf("✗ Audio input unavailable: %s\n", source.c_str());
+    delete analyzer;
+    delete input;
+    return;
+  }
+  animManager.registerAnimation(new AudioAnimation(analyzer, AUDIO_SPECTRUM));
+  animManager.registerAnimation(new AudioAnimation(analyzer, AUDIO_PULSE));
+}
+
+// Pipeline timing on the serial port, every statsIntervalMs (0 = off)
+unsigned long lastStatsMs = 0;
+uint32_t lastStatsFrames = 0;
+
+void printFrameStats(unsigned long now) {
+  const FrameStats& stats = animManager.getFrameStats();
+  uint32_t frames = stats.frames - lastStatsFrames;
+  Serial.printf("[stats] %s: %lu fps, render %lu us (%u bands), post %lu us, remap %lu us (%u px)\n",
+                animManager.getCurrentName(), (unsigned long)(frames * 1000UL / (now - lastStatsMs)),
+                (unsigned long)stats.renderUs, animManager.getRenderBands(),
+                (unsigned long)stats.postUs, (unsigned long)stats.remapUs, stats.remapPixels);
+
+  // Per-pass post cost; fused passes share one time
+  const PostPass* passes;
+  uint8_t passCount = animManager.getCurrentPostChain(passes);
+  if (passCount > 0) {
+    Serial.print("[stats]   post:");
+    uint8_t group = 0;
+    for (uint8_t i = 0; i < passCount; i++) {
+      if (PostProcessor::isFused(passes, i)) {
+        Serial.printf("+%s", PostProcessor::passName(passes[i].type));
+      } else {
+        group = i;
+        Serial.printf("%s %s", i > 0 ? "," : "", PostProcessor::passName(passes[i].type));
+      }
+      if (i + 1 == passCount || !PostProcessor::isFused(passes, i + 1)) {
+        Serial.printf(" %lu us", (unsigned long)stats.postPassUs[group]);
+      }
+    }
+    Serial.println();
+  }
+
+  const ClipCacheStats& cache = ClipCache::shared().getStats();
+  if (cache.budgetBytes > 0) {
+    Serial.printf("[stats]   clip cache: %u clips, %lu/%lu KB used (%lu KB loaded), %lu hits, %lu misses, "
+                  "%lu evictions, %lu rejected\n", cache.clips, (unsigned long)(cache.usedBytes / 1024),
+                  (unsigned long)(cache.budgetBytes / 1024), (unsigned long)(cache.loadedBytes / 1024),
+                  (unsigned long)cache.hits, (unsigned long)cache.misses, (unsigned long)cache.evictions,
+                  (unsigned long)cache.rejected);
+  }
+
+  char detail[128];
+  Animation* anim = animManager.getCurrentAnimation();
+  if (anim && anim->formatStats(detail, sizeof(detail)) > 0) {
+    Serial.printf("[stats]   %s\n", detail);
+  }
+  lastStatsFrames = stats.frames;
+}
+
 void setup() {
   Serial.begin(115200);
   delay(2000);  // Give serial monitor time to connect
@@ -122,27 +251,101 @@ void setup() {
   SolidColorAnimation* solidRed = new SolidColorAnimation(CRGB::Red);
   TextAnimation* staticText = new TextAnimation("HELLO", CRGB::Green, CRGB::Black, 12, true);
   TextAnimation* scrollText = new TextAnimation("SCROLLING TEXT! ", 1, CRGB::Cyan, CRGB::Black, 12);
+  ParagraphAnimation* pagedText = new ParagraphAnimation(
+      "Long messages wrap into lines that fit the panel and page through automatically.",
+      PARAGRAPH_PAGE, ALIGN_CENTER, CRGB::Orange);
+  ParagraphAnimation* newsText = new ParagraphAnimation(
+      "Multi-line text scrolls upwards, line breaks are computed once per message.",
+      PARAGRAPH_SCROLL, ALIGN_LEFT, CRGB::White);
+  StopwatchAnimation* stopwatch = new StopwatchAnimation(CRGB::Yellow);
+
+  // Optional: proportional font for the text animations (tools/font_convert.py)
+  if (configManager.getTextFontPath().length() > 0) {
+    BitmapFont* textFont = new BitmapFont();
+    if (textFont->load(configManager.getTextFontPath().c_str())) {
+      staticText->setFont(textFont);
+      scrollText->setFont(textFont);
+      pagedText->setFont(textFont);
+      newsText->setFont(textFont);
+      stopwatch->setFont(textFont);
+    } else {
+      delete textFont;
+    }
+  }
 
   animManager.registerAnimation(testAnim);
   animManager.registerAnimation(rainbowAnim);
   animManager.registerAnimation(solidRed);
   animManager.registerAnimation(staticText);
   animManager.registerAnimation(scrollText);
+  animManager.registerAnimation(pagedText);
+  animManager.registerAnimation(newsText);
+  animManager.registerAnimation(stopwatch);
+  animManager.registerAnimation(new ParticleAnimation(PARTICLES_FIREWORKS));
+  animManager.registerAnimation(new ParticleAnimation(PARTICLES_SNOW));
+  animManager.registerAnimation(new ParticleAnimation(PARTICLES_SPARKS));
+  animManager.registerAnimation(new LifeAnimation("B3/S23", 100));
+  animManager.registerAnimation(new FireAnimation(FIRE_FLAMES));
+  animManager.registerAnimation(new FireAnimation(FIRE_LAVA));
+  animManager.registerAnimation(new FireAnimation(FIRE_SMOKE));
+  animManager.registerAnimation(new SpriteAnimation(24));
+  animManager.registerAnimation(new NoiseAnimation(NOISE_CLOUDS));
+  animManager.registerAnimation(new NoiseAnimation(NOISE_WATER));
+  animManager.registerAnimation(new NoiseAnimation(NOISE_LAVA));
+  animManager.registerAnimation(new TransformAnimation(
+      new TextAnimation("SPIN", CRGB::Yellow, CRGB::Black, 12, true), "Spin Text", 90, 160, 448, 3000));
+  animManager.registerAnimation(new TransformAnimation(
+      new TestPatternAnimation(), "Rotozoom", -45, 128, 512, 5000, AFFINE_WRAP));
+
+  // Whole LFX clips are kept in PSRAM after their first play (stream only without PSRAM)
+  ClipCache::shared().setBudget(ESP.getPsramSize() > 0 ? configManager.getClipCacheKB() * 1024 : 0);
 
   // Optional: load frame animation from PROGMEM or FS (FS path from config)
-  if (configManager.getFsAnimationPath().length() > 0) {
-    FsFrameSource* fsSrc = new FsFrameSource(configManager.getFsAnimationPath().c_str());
+  String fsPath = configManager.getFsAnimationPath();
+  if (fsPath.length() > 0) {
+    // Fixed installations: play a copy baked into LED order, without the remap.
+    // The canvas path then reads the baked copy too, so the clip has one source
+    IFrameSource* fsSrc = nullptr;
+    FsFrameSource* baked = nullptr;
+    if (configManager.getBakeClips()) {
+      ClipBaker baker(&matrix);
+      baked = baker.open(fsPath.c_str());
+      if (baked) fsSrc = new BakedCanvasSource(baked, &matrix);
+    }
+    if (!fsSrc) fsSrc = new FsFrameSource(fsPath.c_str());
     if (fsSrc->getFrameCount() > 0) {
       FrameAnimation* frameAnim = new FrameAnimation(fsSrc, 100);
+      frameAnim->setPhysicalSource(baked);
       animManager.registerAnimation(frameAnim);
+      // Same clip, spinning and zooming (only one of the two is ever active)
+      animManager.registerAnimation(new TransformAnimation(frameAnim, "Frames Zoom", 30, 192, 320, 4000));
     } else {
       delete fsSrc;
+      delete baked;
     }
   }
 
+  registerShaderAnimations();
+  registerPartitionClips();
+  registerAudioAnimations();
+
   // Auto-cycle from config
   animManager.setAutoCycle(configManager.getAutoCycleMs());
 
+  // Render band-parallel animations on both cores if configured
+  animManager.setRenderBands(configManager.getRenderBands());
+
+  // Per-animation options from config
+  for (uint8_t i = 0; i < configManager.getAnimationOptionCount(); i++) {
+    const AnimationOptions& opts = configManager.getAnimationOptions(i);
+    if (opts.renderScale > 1) {
+      animManager.setRenderScale(opts.name.c_str(), opts.renderScale, opts.upscale);
+    }
+    if (opts.postCount > 0) {
+      animManager.setPostChain(opts.name.c_str(), opts.post, opts.postCount);
+    }
+  }
+
   // Select default animation by name if provided
   String defaultName = configManager.getDefaultAnimation();
   if (!defaultName.isEmpty()) {
@@ -156,7 +359,17 @@ void setup() {
 
 void loop() {
   // Drive current animation
-  animManager.loop(leds);
-  FastLED.show();
+  if (animManager.loop(leds)) {
+    FastLED.show();
+  } else {
+    delay(1);  // Nothing changed: don't spin the loop task
+  }
+
+  uint32_t statsIntervalMs = configManager.getStatsIntervalMs();
+  unsigned long now = millis();
+  if (statsIntervalMs > 0 && now - lastStatsMs >= statsIntervalMs) {
+    printFrameStats(now);
+    lastStatsMs = now;
+  }
 
 }
\ No newline at end of file
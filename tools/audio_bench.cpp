@@ -0,0 +1,135 @@
+// Host-side benchmark for the audio pipeline (WavAudioSource -> AudioAnalyzer).
+//
+// Feeds a 16-bit PCM WAV file through the same analyzer code the firmware
+// runs, either paced to real time with a simulated 60 fps render loop
+// (measuring sample-in to pixel-out latency and the audio task's CPU share),
+// or as fast as possible (--offline, pure analysis throughput).
+//
+// Build (from the repository root):
+//     g++ -std=c++17 -O2 -Iinclude tools/audio_bench.cpp src/AudioAnalyzer.cpp src/FixedFFT.cpp -lpthread -o audio_bench
+// Usage:
+//     ./audio_bench input.wav [--offline]
+//     ./audio_bench --synth test.wav      write a 10 s test track (120 bpm kick + sweep)
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "audio/AudioAnalyzer.h"
+#include "audio/WavAudioSource.h"
+
+static void put16(FILE* f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put32(FILE* f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+static int synth(const char* path) {
+    const uint32_t rate = 22050, seconds = 10, n = rate * seconds;
+    FILE* f = fopen(path, "wb");
+    if (!f) return 1;
+    fwrite("RIFF", 1, 4, f); put32(f, 36 + n * 2); fwrite("WAVE", 1, 4, f);
+    fwrite("fmt ", 1, 4, f); put32(f, 16); put16(f, 1); put16(f, 1);
+    put32(f, rate); put32(f, rate * 2); put16(f, 2); put16(f, 16);
+    fwrite("data", 1, 4, f); put32(f, n * 2);
+
+    double phase = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        double t = (double)i / rate;
+        double beatT = fmod(t, 0.5);   // 120 bpm
+        double kick = exp(-beatT * 30) * sin(2 * M_PI * (60 + 90 * exp(-beatT * 40)) * beatT);
+        phase += 2 * M_PI * (200 + 3000 * (t / seconds)) / rate;
+        double v = 0.6 * kick + 0.15 * sin(phase);
+        put16(f, (uint16_t)(int16_t)lround(v * 32767));
+    }
+    fclose(f);
+    printf("Wrote %s (%u s, %u Hz, kick every 500 ms)\n", path, seconds, rate);
+    return 0;
+}
+
+static int offline(const char* path) {
+    WavAudioSource source(path, false, false);
+    if (!source.begin()) {
+        fprintf(stderr, "Cannot open %s (need 16-bit PCM WAV)\n", path);
+        return 1;
+    }
+    AudioAnalyzer analyzer(&source);
+    analyzer.setSampleRate(source.getSampleRate());
+    AudioSnapshot snap;
+    int16_t hop[AUDIO_HOP];
+    uint32_t blocks = 0, start = audioMicros();
+    while (source.read(hop, AUDIO_HOP) == AUDIO_HOP) {
+        analyzer.process(hop, audioMicros(), snap);
+        blocks++;
+    }
+    uint32_t us = audioMicros() - start;
+    double audioUs = (double)blocks * AUDIO_HOP * 1e6 / source.getSampleRate();
+    printf("Offline: %u blocks, %.1f us/block, %.2f%% of real time, %u beats\n",
+           blocks, blocks ? (double)us / blocks : 0.0, audioUs > 0 ? 100.0 * us / audioUs : 0.0,
+           snap.beatCount);
+    return 0;
+}
+
+static int realtime(const char* path) {
+    WavAudioSource source(path, true, false);
+    AudioAnalyzer analyzer(&source);
+    if (!analyzer.begin()) {
+        fprintf(stderr, "Cannot open %s (need 16-bit PCM WAV)\n", path);
+        return 1;
+    }
+
+    // Render loop stand-in: 60 fps, picks up the newest snapshot and draws bars
+    std::vector<uint32_t> latencies;
+    uint64_t processSum = 0;
+    uint32_t processMax = 0, cpuMax = 0, lastSeq = 0, beats = 0, frames = 0;
+    uint8_t canvas[32][32];
+    while (analyzer.isRunning()) {
+        uint32_t frameStart = audioMicros();
+        AudioSnapshot snap;
+        bool fresh = analyzer.read(snap) && snap.sequence != lastSeq;
+        for (uint8_t y = 0; y < 32; y++) {
+            for (uint8_t x = 0; x < 32; x++) canvas[y][x] = snap.bands[x >> 1] > (31 - y) * 8 ? 255 : 0;
+        }
+        if (fresh) {
+            // Pixel out: the frame built from this block is complete now
+            latencies.push_back(audioMicros() - snap.captureUs);
+            lastSeq = snap.sequence;
+            beats = snap.beatCount;
+            uint32_t p = analyzer.getProcessUs();
+            processSum += p;
+            if (p > processMax) processMax = p;
+            if (analyzer.getCpuPercent() > cpuMax) cpuMax = analyzer.getCpuPercent();
+        }
+        frames++;
+        uint32_t spent = audioMicros() - frameStart;
+        if (spent < 16667) audioSleepMs((16667 - spent) / 1000);
+    }
+    analyzer.end();
+    (void)canvas;
+
+    if (latencies.empty()) {
+        printf("No audio blocks analysed\n");
+        return 1;
+    }
+    uint64_t sum = 0;
+    uint32_t worst = 0;
+    for (uint32_t l : latencies) {
+        sum += l;
+        if (l > worst) worst = l;
+    }
+    uint32_t hopUs = (uint32_t)((uint64_t)AUDIO_HOP * 1000000 / source.getSampleRate());
+    printf("Real time: %u frames, %zu blocks picked up, %u beats\n", frames, latencies.size(), beats);
+    printf("  latency (capture -> frame): avg %.1f ms, max %.1f ms (+%.1f ms window)\n",
+           sum / 1000.0 / latencies.size(), worst / 1000.0, AUDIO_FFT_SIZE * 1000.0 / source.getSampleRate());
+    printf("  analysis: avg %.1f us, max %u us per %u us block (%.2f%% CPU, peak %u%%)\n",
+           (double)processSum / latencies.size(), processMax, hopUs,
+           100.0 * processSum / latencies.size() / hopUs, cpuMax);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && strcmp(argv[1], "--synth") == 0) return synth(argv[2]);
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s input.wav [--offline] | --synth out.wav\n", argv[0]);
+        return 2;
+    }
+    if (argc >= 3 && strcmp(argv[2], "--offline") == 0) return offline(argv[1]);
+    return realtime(argv[1]);
+}
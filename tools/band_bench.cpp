@@ -0,0 +1,145 @@
+// Host-side benchmark for band-parallel rendering (BandWorkerPool).
+//
+// Renders a 32x32 canvas through the same pool the firmware uses, split into
+// 1, 2 and 4 bands (std::threads standing in for the pinned FreeRTOS tasks),
+// and reports the time per frame and the speedup over one band. Two per-pixel
+// workloads bracket the animations: a palette row fill as cheap as Rainbow,
+// and a float plasma as heavy as the shader and noise effects. Every band
+// count must produce the same canvas as the serial render.
+//
+// Restarting a pool (end() then begin(), as a config reload does) must not
+// wake the new workers on the previous job; that is checked first.
+//
+// Speedup needs a core per band; the cheap workload shows what the barrier
+// costs when there is too little work per frame to split.
+//
+// Build (from the repository root):
+//     g++ -std=c++17 -O2 -Iinclude tools/band_bench.cpp src/BandWorkerPool.cpp -lpthread -o band_bench
+// Usage:
+//     ./band_bench [frames]
+
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include "render/BandWorkerPool.h"
+
+#define SIZE 32
+
+static uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Job {
+    uint8_t canvas[SIZE][SIZE][3];
+    uint8_t palette[256][3];
+    uint32_t frameTime;
+};
+
+// Rainbow: one palette lookup per pixel, hue stepped along the row
+static void cheapBand(void* ctx, uint8_t yStart, uint8_t yEnd) {
+    Job* job = (Job*)ctx;
+    uint32_t time = job->frameTime / 20;
+    for (uint8_t y = yStart; y < yEnd; y++) {
+        uint8_t hue = (y * 2 + time) & 0xFF;
+        for (uint8_t x = 0; x < SIZE; x++, hue += 4) {
+            memcpy(job->canvas[y][x], job->palette[hue], 3);
+        }
+    }
+}
+
+// Plasma: a handful of sines per pixel, like a shader or noise effect
+static void heavyBand(void* ctx, uint8_t yStart, uint8_t yEnd) {
+    Job* job = (Job*)ctx;
+    float t = job->frameTime * 0.001f;
+    for (uint8_t y = yStart; y < yEnd; y++) {
+        for (uint8_t x = 0; x < SIZE; x++) {
+            float v = 0;
+            for (int octave = 1; octave <= 4; octave++) {
+                v += sinf(x * 0.2f * octave + t) + sinf(y * 0.3f * octave - t) +
+                     sinf((x + y) * 0.15f * octave + t * 0.5f) + cosf(sqrtf((float)(x * x + y * y)) * 0.1f * octave - t);
+            }
+            uint8_t hue = (uint8_t)(int)(v * 16.0f);
+            memcpy(job->canvas[y][x], job->palette[hue], 3);
+        }
+    }
+}
+
+static double timeFrames(BandWorkerPool& pool, BandWorkerPool::BandFn fn, Job& job, uint32_t frames) {
+    uint64_t start = nowNs();
+    for (uint32_t i = 0; i < frames; i++) {
+        job.frameTime = i * 16;
+        pool.run(fn, &job, SIZE);
+    }
+    return (nowNs() - start) / 1000.0 / frames;
+}
+
+static std::atomic<uint32_t> bandCalls(0);
+
+static void countBand(void*, uint8_t, uint8_t) { bandCalls++; }
+
+// Workers of a restarted pool must wait for the next run()
+static int rebeginCheck() {
+    BandWorkerPool pool;
+    pool.begin(4);
+    for (int i = 0; i < 5; i++) pool.run(countBand, nullptr, SIZE);
+    uint32_t before = bandCalls;
+    pool.begin(4);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint32_t idle = bandCalls - before;
+    pool.run(countBand, nullptr, SIZE);
+    uint32_t ran = bandCalls - before - idle;
+    printf("re-begin: %u band calls before run(), %u for one run()%s\n", idle, ran,
+           idle == 0 && ran == 4 ? "" : "  FAILED");
+    return idle == 0 && ran == 4 ? 0 : 1;
+}
+
+static int bench(const char* name, BandWorkerPool::BandFn fn, uint32_t frames) {
+    static Job job;
+    static uint8_t reference[SIZE][SIZE][3];
+    for (int i = 0; i < 256; i++) {
+        job.palette[i][0] = i;
+        job.palette[i][1] = 255 - i;
+        job.palette[i][2] = i * 7;
+    }
+    job.frameTime = 1234;
+    fn(&job, 0, SIZE);
+    memcpy(reference, job.canvas, sizeof(reference));
+
+    printf("%s:\n", name);
+    double serialUs = 0;
+    const uint8_t bandCounts[] = { 1, 2, 4 };
+    for (uint8_t bands : bandCounts) {
+        BandWorkerPool pool;
+        if (!pool.begin(bands) || pool.getBandCount() != bands) {
+            fprintf(stderr, "  cannot start %u bands\n", bands);
+            return 1;
+        }
+        timeFrames(pool, fn, job, frames / 10 + 1);   // Warm up
+        double us = timeFrames(pool, fn, job, frames);
+        if (bands == 1) serialUs = us;
+
+        memset(job.canvas, 0, sizeof(job.canvas));
+        job.frameTime = 1234;
+        pool.run(fn, &job, SIZE);
+        bool match = memcmp(job.canvas, reference, sizeof(reference)) == 0;
+        printf("  %u band%s %8.2f us/frame  %.2fx%s\n", bands, bands > 1 ? "s" : " ", us,
+               serialUs / us, match ? "" : "  MISMATCH");
+        if (!match) return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? atoi(argv[1]) : 20000;
+    if (frames == 0) frames = 1;
+    unsigned cores = std::thread::hardware_concurrency();
+    printf("%u hardware threads%s\n", cores, cores < 2 ? " (bands cannot run in parallel here)" : "");
+    if (rebeginCheck()) return 1;
+    if (bench("cheap (Rainbow palette fill)", cheapBand, frames)) return 1;
+    return bench("heavy (float plasma)", heavyBand, frames / 10 + 1);
+}
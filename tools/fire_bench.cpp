@@ -0,0 +1,53 @@
+// Host-side benchmark for the heat-field effects (FireAnimation, HeatField).
+//
+// Runs each style at 30 fps frame times, so every frame pays for the full
+// FIRE_MAX_STEPS simulation steps, and reports the average and worst frame,
+// the cost per cell, and the frames over FIRE_BUDGET_US as the animation
+// counts them (the firmware prints the same on its stats line). Build it
+// with -DTOTAL_SIZE=64 (or larger) to see how the kernels scale with the
+// canvas; the cost per cell should stay flat.
+//
+// Build (from the repository root; tools/host stands in for Arduino/FastLED):
+//     g++ -std=c++17 -O2 -Itools/host -Iinclude tools/fire_bench.cpp -o fire_bench
+// Usage:
+//     ./fire_bench [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "animations/FireAnimation.h"
+
+static CRGB canvas[TOTAL_SIZE][TOTAL_SIZE];
+
+static bool bench(FireStyle style, uint32_t frames) {
+    FireAnimation fire(style);
+    fire.setup();
+    uint32_t frameTime = 1;
+    for (uint32_t i = 0; i < 100; i++) {    // Let the field heat up
+        frameTime += 33;
+        fire.renderFrame(canvas, frameTime);
+    }
+    fire.resetStats();
+
+    uint64_t totalUs = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        frameTime += 33;
+        fire.renderFrame(canvas, frameTime);
+        totalUs += fire.getRenderUs();
+    }
+    double avgUs = (double)totalUs / frames;
+    printf("  %-6s avg %7.2f us, worst %5lu us, %6.2f ns/cell, %lu of %u frames over %u us\n",
+           fire.getName(), avgUs, (unsigned long)fire.getMaxRenderUs(),
+           avgUs * 1000.0 / (TOTAL_SIZE * TOTAL_SIZE), (unsigned long)fire.getOverBudget(), frames,
+           FIRE_BUDGET_US);
+    return fire.getOverBudget() == 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? atoi(argv[1]) : 5000;
+    if (frames == 0) frames = 1;
+    printf("%ux%u heat field, %u steps per frame:\n", TOTAL_SIZE, TOTAL_SIZE, FIRE_MAX_STEPS);
+    bool ok = bench(FIRE_FLAMES, frames);
+    ok &= bench(FIRE_LAVA, frames);
+    ok &= bench(FIRE_SMOKE, frames);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+"""Convert a TrueType/OpenType face into proportional bitmap fonts (FNT1).
+
+The output is loaded by BitmapFont (from /fonts on LittleFS) or, with --header,
+compiled into the firmware as a PROGMEM array for BitmapFont::loadFromMemory.
+Each file holds one pixel size; pass several sizes to get one file per size
+(the size is appended to the output name).
+
+Usage:
+    python font_convert.py DejaVuSans.ttf ../data/fonts/sans.fnt --size 8,12
+    python font_convert.py face.ttf face.h --size 10 --header FONT_FACE_10
+Options:
+    --size N[,N...]     pixel size(s) passed to FreeType (default 8)
+    --bpp 1|4           1-bit or 4-bit anti-aliased glyphs (default 1)
+    --chars RANGES      codepoints to include, e.g. 32-126,160-255,8364
+                        (default: printable ASCII and Latin-1)
+    --threshold N       1-bit ink threshold, 0-255 (default 128)
+
+Kerning pairs come from the face's 'kern' table and GPOS kerning (with
+fontTools installed) for every pair of included characters; pairs that round
+to no adjustment at the chosen size are not stored.
+Each glyph bitmap (width x bytes per column) must fit BitmapFont's 192-byte
+cache slot; the tool stops with an error naming the largest glyph otherwise.
+Requires Pillow (pip install pillow); fontTools is optional (pip install fonttools).
+"""
+
+import struct
+import sys
+
+DEFAULT_CHARS = '32-126,160-255'
+# BitmapFont streams glyph bitmaps through fixed cache slots of this many
+# bytes (FONT_CACHE_SLOT_BYTES in include/render/BitmapFont.h) and rejects
+# fonts with a larger glyph; keep the two in step
+GLYPH_MAX_BYTES = 192
+
+
+def parse_ranges(spec):
+    codepoints = set()
+    for part in spec.split(','):
+        if '-' in part:
+            lo, hi = part.split('-')
+            codepoints.update(range(int(lo, 0), int(hi, 0) + 1))
+        elif part:
+            codepoints.add(int(part, 0))
+    bad = [c for c in codepoints if c > 0xFFFF]
+    if bad:
+        raise ValueError('codepoint U+%X is outside the 16-bit range FNT1 supports' % bad[0])
+    return sorted(codepoints)
+
+
+def render_glyphs(face_path, size, codepoints, bpp, threshold):
+    from PIL import Image, ImageDraw, ImageFont   # Only needed for conversion
+
+    font = ImageFont.truetype(face_path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+    if height > 32:
+        raise ValueError('size %d gives %d-pixel rows; FNT1 glyphs are at most 32 rows' % (size, height))
+
+    glyphs = []
+    for cp in codepoints:
+        ch = chr(cp)
+        blank = font.getmask(ch).getbbox() is None
+        if blank and not ch.isspace():
+            continue   # Not in the face: leave it to the default glyph
+        x0, _, x1, _ = font.getbbox(ch)
+        if blank:
+            x0, x1 = 0, 0
+        width = x1 - x0
+        advance = int(round(font.getlength(ch)))
+
+        columns = []
+        if width:
+            image = Image.new('L', (width, height), 0)
+            ImageDraw.Draw(image).text((-x0, 0), ch, font=font, fill=255)
+            pixels = image.load()
+            for x in range(width):
+                values = [pixels[x, y] for y in range(height)]
+                if bpp == 1:
+                    columns.append([1 if v >= threshold else 0 for v in values])
+                else:
+                    columns.append([(v * 15 + 127) // 255 for v in values])
+        glyphs.append((cp, x0, advance, columns))
+
+    chars = [g[0] for g in glyphs]
+    try:
+        kerning = face_kerning(face_path, size, chars)
+    except ImportError:
+        # Without fontTools, measure pairs through FreeType (only sees a 'kern' table)
+        kerning = []
+        for a in chars:
+            la = font.getlength(chr(a))
+            for b in chars:
+                adjust = int(round(font.getlength(chr(a) + chr(b)) - la - font.getlength(chr(b))))
+                if adjust:
+                    kerning.append((a, b, max(-128, min(127, adjust))))
+    return height, ascent, glyphs, kerning
+
+
+def face_kerning(face_path, size, chars):
+    """Pair adjustments in pixels from the face's 'kern' table and GPOS 'kern' feature."""
+    from fontTools.ttLib import TTFont
+
+    tt = TTFont(face_path)
+    cmap = tt.getBestCmap()
+    upem = tt['head'].unitsPerEm
+    names = {cmap[c]: c for c in chars if c in cmap}
+    units = {}
+
+    if 'kern' in tt:
+        for table in tt['kern'].kernTables:
+            for (left, right), value in getattr(table, 'kernTable', {}).items():
+                if left in names and right in names:
+                    units[(left, right)] = value
+
+    if 'GPOS' in tt and tt['GPOS'].table.FeatureList:
+        gpos = tt['GPOS'].table
+        lookups = set()
+        for record in gpos.FeatureList.FeatureRecord:
+            if record.FeatureTag == 'kern':
+                lookups.update(record.Feature.LookupListIndex)
+        for index in sorted(lookups):
+            lookup = gpos.LookupList.Lookup[index]
+            for sub in lookup.SubTable:
+                if lookup.LookupType == 9:
+                    sub = sub.ExtSubTable
+                if sub.LookupType != 2:
+                    continue
+                if sub.Format == 1:
+                    for i, first in enumerate(sub.Coverage.glyphs):
+                        if first not in names:
+                            continue
+                        for pair in sub.PairSet[i].PairValueRecord:
+                            value = getattr(pair.Value1, 'XAdvance', 0) if pair.Value1 else 0
+                            if pair.SecondGlyph in names and value:
+                                units.setdefault((first, pair.SecondGlyph), value)
+                elif sub.Format == 2:
+                    covered = set(sub.Coverage.glyphs)
+                    class1 = sub.ClassDef1.classDefs
+                    class2 = sub.ClassDef2.classDefs
+                    for first in names:
+                        if first not in covered:
+                            continue
+                        row = sub.Class1Record[class1.get(first, 0)].Class2Record
+                        for second in names:
+                            record = row[class2.get(second, 0)]
+                            value = getattr(record.Value1, 'XAdvance', 0) if record.Value1 else 0
+                            if value:
+                                units.setdefault((first, second), value)
+
+    kerning = []
+    for (left, right), value in units.items():
+        adjust = int(round(value * size / upem))
+        if adjust:
+            kerning.append((names[left], names[right], max(-128, min(127, adjust))))
+    return kerning
+
+
+def pack_column(values, bpp):
+    out = bytearray((len(values) * bpp + 7) // 8)
+    for row, v in enumerate(values):
+        if bpp == 1:
+            if v:
+                out[row >> 3] |= 1 << (row & 7)
+        else:
+            out[row >> 1] |= v << ((row & 1) * 4)
+    return bytes(out)
+
+
+def encode(height, baseline, glyphs, kerning, bpp):
+    bitmaps = bytearray()
+    table = bytearray()
+    column_bytes = (height * bpp + 7) // 8
+    too_large = [(len(g[3]) * column_bytes, g[0]) for g in glyphs if len(g[3]) * column_bytes > GLYPH_MAX_BYTES]
+    if too_large:
+        largest, cp = max(too_large)
+        raise ValueError('%d glyphs exceed the %d-byte glyph cache slot BitmapFont loads into '
+                         '(largest U+%04X, %d bytes); use a smaller --size, --bpp 1, or '
+                         'leave the wide characters out with --chars'
+                         % (len(too_large), GLYPH_MAX_BYTES, cp, largest))
+    for cp, x_offset, advance, columns in glyphs:
+        if len(columns) > 255 or advance > 255:
+            raise ValueError('glyph U+%04X is too wide' % cp)
+        table += struct.pack('<HBBbBI', cp, len(columns), advance, max(-128, min(127, x_offset)), 0, len(bitmaps))
+        for column in columns:
+            bitmaps += pack_column(column, bpp)
+
+    kerns = b''.join(struct.pack('<HHbB', a, b, adjust, 0) for a, b, adjust in sorted(kerning))
+    default = ord('?') if any(g[0] == ord('?') for g in glyphs) else glyphs[0][0]
+    header = struct.pack('<4sBBBBHHHH', b'FNT1', height, baseline, bpp, 0,
+                         len(glyphs), len(kerning), default, 0)
+    return header + bytes(table) + kerns + bytes(bitmaps)
+
+
+def to_header(blob, name, source):
+    lines = ['// Generated by tools/font_convert.py from %s - do not edit' % source,
+             '#pragma once', '#include <Arduino.h>', '',
+             'static const uint8_t %s[] PROGMEM = {' % name]
+    for i in range(0, len(blob), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in blob[i:i + 16]) + ',')
+    lines += ['};', 'static const size_t %s_SIZE = %d;' % (name, len(blob)), '']
+    return '\n'.join(lines)
+
+
+def output_path(path, size, multiple):
+    if not multiple:
+        return path
+    dot = path.rfind('.')
+    return '%s-%d%s' % (path[:dot], size, path[dot:]) if dot > path.rfind('/') else '%s-%d' % (path, size)
+
+
+def main():
+    args = sys.argv[1:]
+    sizes = [8]
+    bpp = 1
+    chars = DEFAULT_CHARS
+    threshold = 128
+    header = None
+    positional = []
+    while args:
+        arg = args.pop(0)
+        if arg == '--size':
+            sizes = [int(s) for s in args.pop(0).split(',')]
+        elif arg == '--bpp':
+            bpp = int(args.pop(0))
+        elif arg == '--chars':
+            chars = args.pop(0)
+        elif arg == '--threshold':
+            threshold = int(args.pop(0))
+        elif arg == '--header':
+            header = args.pop(0)
+        else:
+            positional.append(arg)
+    if len(positional) != 2 or bpp not in (1, 4):
+        print(__doc__)
+        return 1
+
+    try:
+        codepoints = parse_ranges(chars)
+        for size in sizes:
+            height, baseline, glyphs, kerning = render_glyphs(positional[0], size, codepoints, bpp, threshold)
+            if not glyphs:
+                raise ValueError('no glyphs rendered')
+            blob = encode(height, baseline, glyphs, kerning, bpp)
+            out = output_path(positional[1], size, len(sizes) > 1)
+            if header:
+                name = header if len(sizes) == 1 else '%s_%d' % (header, size)
+                with open(out, 'w') as f:
+                    f.write(to_header(blob, name, positional[0].replace('\\', '/').split('/')[-1]))
+            else:
+                with open(out, 'wb') as f:
+                    f.write(blob)
+            print('%s: %d glyphs, %d px rows, %d bpp, %d kerning pairs, %d bytes'
+                  % (out, len(glyphs), height, bpp, len(kerning), len(blob)))
+    except (ValueError, OSError) as e:
+        print('%s: %s' % (positional[0], e), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
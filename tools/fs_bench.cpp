@@ -0,0 +1,92 @@
+// Host-side harness for the streaming frame source (FsFrameSource).
+//
+// Plays an LFX clip (any format tools/lfx_encode.py writes) through two
+// sources at a fixed frame rate: one reading synchronously, and one with the
+// read-ahead ring filled by the prefetch thread (the std::thread build of the
+// firmware's FreeRTOS task). Every frame of the two is compared, and each
+// source's FrameSourceStats are reported as the firmware prints them on its
+// stats line: ring hits and misses, getFrameInto() time and the background
+// fetch time. The PSRAM clip cache is off, so every frame comes from the file.
+//
+// Build (from the repository root; tools/host stands in for Arduino/LittleFS):
+//     g++ -std=c++17 -O2 -pthread -Itools/host -Iinclude tools/fs_bench.cpp src/FsFrameSource.cpp src/LfxDecoder.cpp src/ClipCache.cpp -o fs_bench
+// Usage:
+//     python tools/lfx_encode.py clip.gif clip.lfx
+//     ./fs_bench clip.lfx [--fps N] [--frames N]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "frame_io/FsFrameSource.h"
+
+static CRGB syncFrame[32 * 32];
+static CRGB prefetchFrame[32 * 32];
+
+static void report(const char* label, const FsFrameSource& source) {
+    FrameSourceStats s;
+    source.getStats(s);
+    printf("  %-10s %5lu hits, %5lu misses, read %5lu us (max %5lu), fetch %5lu us\n", label,
+           (unsigned long)s.hits, (unsigned long)s.misses, (unsigned long)s.lastReadUs,
+           (unsigned long)s.maxReadUs, (unsigned long)s.fetchUs);
+}
+
+int main(int argc, char** argv) {
+    const char* clipPath = nullptr;
+    uint32_t fps = 30;
+    uint32_t frames = 300;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) fps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else clipPath = argv[i];
+    }
+    if (!clipPath || fps == 0) {
+        fprintf(stderr, "usage: %s clip.lfx [--fps N] [--frames N]\n", argv[0]);
+        return 2;
+    }
+
+    // The clip's directory plays the part of the LittleFS root
+    String path(clipPath);
+    int slash = path.lastIndexOf('/');
+    if (slash >= 0) {
+        LittleFS.setRoot(path.substring(0, slash).c_str());
+        path = path.substring(slash);
+    } else {
+        path = String("/") + path;
+    }
+    ClipCache::shared().setBudget(0);
+
+    FsFrameSource sync(path.c_str(), 0);
+    FsFrameSource prefetch(path.c_str(), FS_PREFETCH_FRAMES);
+    if (!sync.isValid() || !prefetch.isValid()) {
+        fprintf(stderr, "%s: not a 32x32 LFX clip\n", clipPath);
+        return 1;
+    }
+
+    printf("%s: %u frames, playing %u at %u fps\n", clipPath, sync.getFrameCount(), frames, fps);
+    uint32_t period = 1000000 / fps;
+    uint32_t mismatches = 0;
+    unsigned long next = micros();
+    for (uint32_t i = 0; i < frames; i++) {
+        uint16_t index = i % sync.getFrameCount();
+        sync.getFrameInto(index, syncFrame);
+        prefetch.getFrameInto(index, prefetchFrame);
+        if (memcmp(syncFrame, prefetchFrame, sizeof(syncFrame)) != 0) {
+            if (mismatches == 0) printf("  frame %u differs between the two sources\n", index);
+            mismatches++;
+        }
+
+        // Idle until the next frame is due, as the render loop would
+        next += period;
+        long wait = (long)(next - micros());
+        if (wait > 0) delay(wait / 1000);
+    }
+
+    report("sync", sync);
+    report("prefetch", prefetch);
+    if (mismatches) {
+        printf("  %u of %u frames differ\n", mismatches, frames);
+        return 1;
+    }
+    printf("  all %u frames match\n", frames);
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Host stand-in for the parts of the Arduino core the firmware sources use, so
+// the host benchmarks in tools/ can build animations and frame sources as they
+// are. Add -Itools/host before -Iinclude; never used by the firmware build.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define memcpy_P memcpy
+#define ps_malloc malloc
+
+template <typename T, typename L, typename H>
+inline T constrain(T v, L lo, H hi) { return v < lo ? (T)lo : (v > hi ? (T)hi : v); }
+
+inline unsigned long micros() {
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+inline void delay(unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+inline void yield() { std::this_thread::yield(); }
+
+class String {
+private:
+    std::string s;
+
+public:
+    String() {}
+    String(const char* str) : s(str ? str : "") {}
+    String(const std::string& str) : s(str) {}
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    char operator[](unsigned int i) const { return i < s.size() ? s[i] : 0; }
+
+    int indexOf(char c) const { size_t p = s.find(c); return p == std::string::npos ? -1 : (int)p; }
+    int lastIndexOf(char c) const { size_t p = s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+    bool endsWith(const String& suffix) const {
+        return s.size() >= suffix.s.size() && s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+    }
+    String substring(unsigned int from) const { return from < s.size() ? String(s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+        return from < to && from < s.size() ? String(s.substr(from, to - from)) : String();
+    }
+
+    String& operator+=(const String& o) { s += o.s; return *this; }
+    String& operator+=(const char* o) { s += o; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const String& a, const char* b) { return String(a.s + b); }
+    bool operator==(const String& o) const { return s == o.s; }
+    bool operator==(const char* o) const { return s == o; }
+    bool operator!=(const String& o) const { return s != o.s; }
+};
+
+// Serial output goes to stdout; quiet() silences it for timed sections
+class HostSerial {
+private:
+    bool muted = false;
+
+public:
+    void begin(unsigned long) {}
+    void quiet(bool on) { muted = on; }
+    int printf(const char* fmt, ...) {
+        if (muted) return 0;
+        va_list args;
+        va_start(args, fmt);
+        int n = vprintf(fmt, args);
+        va_end(args);
+        return n;
+    }
+    void print(const char* str) { if (!muted) fputs(str, stdout); }
+    void println(const char* str = "") { if (!muted) puts(str); }
+    void print(const String& str) { print(str.c_str()); }
+    void println(const String& str) { println(str.c_str()); }
+};
+
+inline HostSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,213 @@
+// Host stand-in for the FastLED calls the firmware sources use (see Arduino.h
+// in this directory). The 8-bit math, sin8/sin16, random8/16 and inoise8
+// follow FastLED's portable C implementations step for step, so host timings
+// compare like with like; HSV conversion is a plain hexcone instead of
+// FastLED's rainbow mapping, which only matters for palettes built at setup.
+#ifndef HOST_FASTLED_H
+#define HOST_FASTLED_H
+
+#include "Arduino.h"
+
+inline uint8_t scale8(uint8_t i, uint8_t scale) { return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8; }
+inline uint8_t qadd8(uint8_t i, uint8_t j) { unsigned t = i + j; return t > 255 ? 255 : t; }
+inline uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, uint8_t frac) {
+    return b > a ? a + scale8(b - a, frac) : a - scale8(a - b, frac);
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+    uint16_t partial = (a << 8) | b;
+    partial += b * amountOfB;
+    partial -= a * amountOfB;
+    return partial >> 8;
+}
+
+inline int16_t sin16(uint16_t theta) {
+    static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+    static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+    uint16_t offset = (theta & 0x3FFF) >> 3;
+    if (theta & 0x4000) offset = 2047 - offset;
+    uint8_t section = offset / 256;
+    uint8_t secoffset8 = (uint8_t)offset / 2;
+    int16_t y = slope[section] * secoffset8 + base[section];
+    return (theta & 0x8000) ? -y : y;
+}
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+inline uint8_t sin8(uint8_t theta) {
+    static const uint8_t bm16[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+    uint8_t offset = theta;
+    if (theta & 0x40) offset = 255 - offset;
+    offset &= 0x3F;
+    uint8_t secoffset = offset & 0x0F;
+    if (theta & 0x40) secoffset++;
+    uint8_t section = offset >> 4;
+    uint8_t mx = (bm16[section * 2 + 1] * secoffset) >> 4;
+    int8_t y = mx + bm16[section * 2];
+    if (theta & 0x80) y = -y;
+    return y + 128;
+}
+inline uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+
+inline uint16_t& hostRandSeed() { static uint16_t seed = 1337; return seed; }
+inline uint16_t random16() { hostRandSeed() = hostRandSeed() * 2053 + 13849; return hostRandSeed(); }
+inline uint8_t random8() { uint16_t r = random16(); return (uint8_t)(r & 0xFF) + (uint8_t)(r >> 8); }
+inline uint8_t random8(uint8_t lim) { return (random8() * lim) >> 8; }
+inline uint8_t random8(uint8_t min, uint8_t lim) { return min + random8(lim - min); }
+inline uint16_t random16(uint16_t lim) { return ((uint32_t)random16() * lim) >> 16; }
+inline uint16_t random16(uint16_t min, uint16_t lim) { return min + random16(lim - min); }
+inline void random16_set_seed(uint16_t seed) { hostRandSeed() = seed; }
+inline void random16_add_entropy(uint16_t entropy) { hostRandSeed() += entropy; }
+
+// ---- Perlin noise, 8-bit (FastLED noise.cpp)
+
+inline uint8_t hostNoiseP(uint8_t i) {
+    static const uint8_t p[256] = {
+        151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225, 140, 36, 103, 30, 69, 142,
+        8, 99, 37, 240, 21, 10, 23, 190, 6, 148, 247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203,
+        117, 35, 11, 32, 57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175, 74,
+        165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122, 60, 211, 133, 230, 220,
+        105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54, 65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132,
+        187, 208, 89, 18, 169, 200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3,
+        64, 52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212, 207, 206, 59,
+        227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213, 119, 248, 152, 2, 44, 154, 163, 70,
+        221, 153, 101, 155, 167, 43, 172, 9, 129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232,
+        178, 185, 112, 104, 218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162,
+        241, 81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157, 184, 84, 204,
+        176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93, 222, 114, 67, 29, 24, 72, 243, 141,
+        128, 195, 78, 66, 215, 61, 156, 180 };
+    return p[i];
+}
+
+inline uint8_t ease8InOutQuad(uint8_t i) {
+    uint8_t j = i;
+    if (j & 0x80) j = 255 - j;
+    uint8_t jj2 = scale8(j, j) << 1;
+    return (i & 0x80) ? 255 - jj2 : jj2;
+}
+
+inline int8_t avg7(int8_t i, int8_t j) { return (i >> 1) + (j >> 1) + (i & 0x1); }
+
+inline int8_t lerp7by8(int8_t a, int8_t b, uint8_t frac) {
+    return b > a ? a + scale8((uint8_t)(b - a), frac) : a - scale8((uint8_t)(a - b), frac);
+}
+
+inline int8_t grad8(uint8_t hash, int8_t x, int8_t y) {
+    int8_t u, v;
+    if (hash & 4) { u = y; v = x; } else { u = x; v = y; }
+    if (hash & 1) u = -u;
+    if (hash & 2) v = -v;
+    return avg7(u, v);
+}
+
+inline int8_t grad8(uint8_t hash, int8_t x, int8_t y, int8_t z) {
+    hash &= 0xF;
+    int8_t u = (hash & 8) ? y : x;
+    int8_t v = hash < 4 ? y : (hash == 12 || hash == 14 ? x : z);
+    if (hash & 1) u = -u;
+    if (hash & 2) v = -v;
+    return avg7(u, v);
+}
+
+inline int8_t inoise8_raw(uint16_t x, uint16_t y) {
+    uint8_t X = x >> 8, Y = y >> 8;
+    uint8_t A = hostNoiseP(X) + Y, AA = hostNoiseP(A), AB = hostNoiseP(A + 1);
+    uint8_t B = hostNoiseP(X + 1) + Y, BA = hostNoiseP(B), BB = hostNoiseP(B + 1);
+    int8_t xx = ((uint8_t)x >> 1) & 0x7F, yy = ((uint8_t)y >> 1) & 0x7F;
+    const uint8_t N = 0x80;
+    uint8_t u = ease8InOutQuad((uint8_t)x), v = ease8InOutQuad((uint8_t)y);
+    int8_t X1 = lerp7by8(grad8(hostNoiseP(AA), xx, yy), grad8(hostNoiseP(BA), xx - N, yy), u);
+    int8_t X2 = lerp7by8(grad8(hostNoiseP(AB), xx, yy - N), grad8(hostNoiseP(BB), xx - N, yy - N), u);
+    return lerp7by8(X1, X2, v);
+}
+
+inline int8_t inoise8_raw(uint16_t x, uint16_t y, uint16_t z) {
+    uint8_t X = x >> 8, Y = y >> 8, Z = z >> 8;
+    uint8_t A = hostNoiseP(X) + Y, AA = hostNoiseP(A) + Z, AB = hostNoiseP(A + 1) + Z;
+    uint8_t B = hostNoiseP(X + 1) + Y, BA = hostNoiseP(B) + Z, BB = hostNoiseP(B + 1) + Z;
+    int8_t xx = ((uint8_t)x >> 1) & 0x7F, yy = ((uint8_t)y >> 1) & 0x7F, zz = ((uint8_t)z >> 1) & 0x7F;
+    const uint8_t N = 0x80;
+    uint8_t u = ease8InOutQuad((uint8_t)x), v = ease8InOutQuad((uint8_t)y), w = ease8InOutQuad((uint8_t)z);
+    int8_t X1 = lerp7by8(grad8(hostNoiseP(AA), xx, yy, zz), grad8(hostNoiseP(BA), xx - N, yy, zz), u);
+    int8_t X2 = lerp7by8(grad8(hostNoiseP(AB), xx, yy - N, zz), grad8(hostNoiseP(BB), xx - N, yy - N, zz), u);
+    int8_t X3 = lerp7by8(grad8(hostNoiseP(AA + 1), xx, yy, zz - N), grad8(hostNoiseP(BA + 1), xx - N, yy, zz - N), u);
+    int8_t X4 = lerp7by8(grad8(hostNoiseP(AB + 1), xx, yy - N, zz - N), grad8(hostNoiseP(BB + 1), xx - N, yy - N, zz - N), u);
+    int8_t Y1 = lerp7by8(X1, X2, v);
+    int8_t Y2 = lerp7by8(X3, X4, v);
+    return lerp7by8(Y1, Y2, w);
+}
+
+inline uint8_t inoise8(uint16_t x, uint16_t y) {
+    int8_t n = inoise8_raw(x, y) + 64;
+    return qadd8(n, n);
+}
+
+inline uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) {
+    int8_t n = inoise8_raw(x, y, z) + 64;
+    return qadd8(n, n);
+}
+
+// ---- Colours
+
+struct CHSV {
+    uint8_t h, s, v;
+    CHSV() : h(0), s(0), v(0) {}
+    CHSV(uint8_t hue, uint8_t sat, uint8_t val) : h(hue), s(sat), v(val) {}
+};
+
+struct CRGB {
+    union {
+        struct { uint8_t r, g, b; };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode : uint32_t {
+        Black = 0x000000, White = 0xFFFFFF, Red = 0xFF0000, Green = 0x008000, Blue = 0x0000FF,
+        Yellow = 0xFFFF00, Cyan = 0x00FFFF, Magenta = 0xFF00FF, Orange = 0xFFA500
+    };
+
+    CRGB() {}
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t code) : r(code >> 16), g(code >> 8), b(code) {}
+    CRGB(HTMLColorCode code) : CRGB((uint32_t)code) {}
+    CRGB(const CHSV& hsv) { *this = hsv; }
+
+    CRGB& operator=(const CHSV& hsv) {
+        uint8_t region = hsv.h / 43, rem = (hsv.h - region * 43) * 6;
+        uint8_t p = (hsv.v * (255 - hsv.s)) >> 8;
+        uint8_t q = (hsv.v * (255 - ((hsv.s * rem) >> 8))) >> 8;
+        uint8_t t = (hsv.v * (255 - ((hsv.s * (255 - rem)) >> 8))) >> 8;
+        switch (region) {
+            case 0: r = hsv.v; g = t; b = p; break;
+            case 1: r = q; g = hsv.v; b = p; break;
+            case 2: r = p; g = hsv.v; b = t; break;
+            case 3: r = p; g = q; b = hsv.v; break;
+            case 4: r = t; g = p; b = hsv.v; break;
+            default: r = hsv.v; g = p; b = q; break;
+        }
+        return *this;
+    }
+
+    uint8_t& operator[](uint8_t i) { return raw[i]; }
+    const uint8_t& operator[](uint8_t i) const { return raw[i]; }
+
+    CRGB& operator+=(const CRGB& o) { r = qadd8(r, o.r); g = qadd8(g, o.g); b = qadd8(b, o.b); return *this; }
+    CRGB& nscale8(uint8_t scale) { r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale); return *this; }
+    CRGB& fadeToBlackBy(uint8_t fade) { return nscale8(255 - fade); }
+
+    bool operator==(const CRGB& o) const { return r == o.r && g == o.g && b == o.b; }
+    bool operator!=(const CRGB& o) const { return !(*this == o); }
+};
+
+inline CRGB blend(const CRGB& a, const CRGB& b, uint8_t amountOfB) {
+    return CRGB(blend8(a.r, b.r, amountOfB), blend8(a.g, b.g, amountOfB), blend8(a.b, b.b, amountOfB));
+}
+
+inline CRGB& nblend(CRGB& existing, const CRGB& overlay, uint8_t amountOfOverlay) {
+    if (amountOfOverlay == 255) return existing = overlay;
+    if (amountOfOverlay > 0) existing = blend(existing, overlay, amountOfOverlay);
+    return existing;
+}
+
+#endif // HOST_FASTLED_H
@@ -0,0 +1,85 @@
+// Host stand-in for LittleFS (see Arduino.h in this directory): paths map onto
+// a directory of the host filesystem, "." unless LittleFS.setRoot() says
+// otherwise. Only what the firmware sources call is provided.
+#ifndef HOST_LITTLEFS_H
+#define HOST_LITTLEFS_H
+
+#include <memory>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include "Arduino.h"
+
+enum SeekMode { SeekSet = SEEK_SET, SeekCur = SEEK_CUR, SeekEnd = SEEK_END };
+
+class File {
+private:
+    std::shared_ptr<FILE> f;
+    String path;
+
+public:
+    File() {}
+    File(FILE* fp, const char* name) : f(fp, fclose), path(name) {}
+
+    operator bool() const { return (bool)f; }
+    void close() { f.reset(); }
+    const char* name() const { return path.c_str(); }
+
+    size_t size() const {
+        if (!f) return 0;
+        struct stat st;
+        fflush(f.get());
+        return fstat(fileno(f.get()), &st) == 0 ? st.st_size : 0;
+    }
+    time_t getLastWrite() const {
+        struct stat st;
+        return f && fstat(fileno(f.get()), &st) == 0 ? st.st_mtime : 0;
+    }
+    bool seek(uint32_t pos, SeekMode mode = SeekSet) { return f && fseek(f.get(), pos, mode) == 0; }
+    size_t position() const { return f ? ftell(f.get()) : 0; }
+    size_t read(uint8_t* buf, size_t len) { return f ? fread(buf, 1, len, f.get()) : 0; }
+    size_t readBytes(char* buf, size_t len) { return read((uint8_t*)buf, len); }
+    String readString() {
+        std::string s;
+        char buf[256];
+        size_t n;
+        while ((n = read((uint8_t*)buf, sizeof(buf))) > 0) s.append(buf, n);
+        return String(s);
+    }
+    size_t write(const uint8_t* buf, size_t len) { return f ? fwrite(buf, 1, len, f.get()) : 0; }
+};
+
+class HostLittleFS {
+private:
+    std::string root = ".";
+
+    std::string full(const char* path) const { return root + (path[0] == '/' ? "" : "/") + path; }
+
+public:
+    void setRoot(const char* dir) { root = dir; }
+
+    bool begin(bool formatOnFail = false) { return true; }
+    bool exists(const char* path) const {
+        struct stat st;
+        return stat(full(path).c_str(), &st) == 0;
+    }
+    File open(const char* path, const char* mode = "r") {
+        FILE* fp = fopen(full(path).c_str(), mode[0] == 'w' ? "wb" : (mode[0] == 'a' ? "ab" : "rb"));
+        return fp ? File(fp, path) : File();
+    }
+    bool exists(const String& path) const { return exists(path.c_str()); }
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    size_t totalBytes() const {
+        struct statvfs vfs;
+        return statvfs(root.c_str(), &vfs) == 0 ? (size_t)vfs.f_blocks * vfs.f_frsize : 0;
+    }
+    size_t usedBytes() const {
+        struct statvfs vfs;
+        return statvfs(root.c_str(), &vfs) == 0 ? (size_t)(vfs.f_blocks - vfs.f_bfree) * vfs.f_frsize : 0;
+    }
+    bool remove(const char* path) { return ::remove(full(path).c_str()) == 0; }
+    bool rename(const char* from, const char* to) { return ::rename(full(from).c_str(), full(to).c_str()) == 0; }
+};
+
+inline HostLittleFS LittleFS;
+
+#endif // HOST_LITTLEFS_H
@@ -0,0 +1,214 @@
+// Host-side benchmark for compressed LFX2 clips (tools/lfx_encode.py output).
+//
+// Decodes the clip with the same LfxDecoder the firmware uses and reports the
+// compression ratio, the keyframe/delta/repeat mix, the decode time per frame
+// in playback order and for random seeks, and the compressed bytes read per
+// second of playback. Given the raw LFX1 clip it was encoded from, it also
+// checks every decoded frame against it.
+//
+// With --pack, maps a clip partition image (tools/lfx_pack.py) the way the
+// firmware maps the flash partition, and compares handing out raw frames in
+// place against reading each frame into a buffer through stdio.
+//
+// Build (from the repository root):
+//     g++ -std=c++17 -O2 -Iinclude tools/lfx_bench.cpp src/LfxDecoder.cpp src/ClipPartition.cpp -o lfx_bench
+// Usage:
+//     ./lfx_bench clip.lfx [raw_lfx1_reference.lfx] [--fps N]
+//     ./lfx_bench --pack clips.bin
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "frame_io/ClipPartition.h"
+#include "frame_io/LfxDecoder.h"
+
+static uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Whole clip in memory, so the numbers are decode time rather than disk time
+class MemoryReader : public LfxReader {
+public:
+    std::vector<uint8_t> data;
+    uint64_t bytesRead = 0;
+    size_t readAt(uint32_t offset, uint8_t* dst, size_t len) override {
+        if (offset >= data.size()) return 0;
+        if (len > data.size() - offset) len = data.size() - offset;
+        memcpy(dst, data.data() + offset, len);
+        bytesRead += len;
+        return len;
+    }
+};
+
+static bool loadFile(const char* path, std::vector<uint8_t>& out) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    out.resize(ftell(f));
+    fseek(f, 0, SEEK_SET);
+    bool ok = fread(out.data(), 1, out.size(), f) == out.size();
+    fclose(f);
+    return ok && out.size() >= sizeof(LfxHeader);
+}
+
+// The render loop's use of a frame: copy it into the 32x32 canvas
+static uint32_t toCanvas(const uint8_t* frame, uint8_t canvas[32][32][3]) {
+    memcpy(canvas, frame, LFX_FRAME_BYTES);
+    return canvas[31][31][2];
+}
+
+static int packBench(const char* imagePath) {
+    ClipPartition part;
+    if (!part.begin(imagePath)) {
+        fprintf(stderr, "%s is not a clip partition image\n", imagePath);
+        return 1;
+    }
+    FILE* f = fopen(imagePath, "rb");
+    if (!f) return 1;
+
+    static uint8_t canvas[32][32][3];
+    static uint8_t frame[LFX_FRAME_BYTES];
+    uint32_t sink = 0;
+    printf("%s: %u clips\n", imagePath, part.getCount());
+    for (uint16_t c = 0; c < part.getCount(); c++) {
+        const ClipPackEntry& entry = part.getEntry(c);
+        const uint8_t* clip = part.getClip(c);
+        LfxHeader header;
+        memcpy(&header, clip, sizeof(header));
+        if (memcmp(header.magic, "LFX1", 4) != 0 || header.format != LFX_FORMAT_RGB888) {
+            printf("  %-23s skipped (only raw RGB888 clips play in place)\n", entry.name);
+            continue;
+        }
+        const uint32_t frames = header.frames;
+        const uint32_t passes = 20000 / frames + 1;
+
+        // In place: a pointer into the mapping, straight to the canvas
+        uint64_t start = nowNs();
+        for (uint32_t p = 0; p < passes; p++) {
+            for (uint32_t i = 0; i < frames; i++) {
+                sink += toCanvas(clip + sizeof(LfxHeader) + (size_t)i * LFX_FRAME_BYTES, canvas);
+            }
+        }
+        double mappedUs = (nowNs() - start) / 1000.0 / ((double)passes * frames);
+
+        // Read path: seek + read into a frame buffer, then to the canvas
+        uint32_t bad = 0;
+        start = nowNs();
+        for (uint32_t p = 0; p < passes; p++) {
+            for (uint32_t i = 0; i < frames; i++) {
+                size_t at = entry.offset + sizeof(LfxHeader) + (size_t)i * LFX_FRAME_BYTES;
+                if (fseek(f, at, SEEK_SET) != 0 || fread(frame, 1, LFX_FRAME_BYTES, f) != LFX_FRAME_BYTES) bad++;
+                sink += toCanvas(frame, canvas);
+            }
+        }
+        double readUs = (nowNs() - start) / 1000.0 / ((double)passes * frames);
+
+        for (uint32_t i = 0; i < frames; i++) {
+            fseek(f, entry.offset + sizeof(LfxHeader) + (size_t)i * LFX_FRAME_BYTES, SEEK_SET);
+            if (fread(frame, 1, LFX_FRAME_BYTES, f) != LFX_FRAME_BYTES ||
+                memcmp(frame, clip + sizeof(LfxHeader) + (size_t)i * LFX_FRAME_BYTES, LFX_FRAME_BYTES) != 0) bad++;
+        }
+        printf("  %-23s %u frames: in place %.2f us/frame, read + copy %.2f us/frame (%.1fx)%s\n",
+               entry.name, frames, mappedUs, readUs, readUs / mappedUs, bad ? ", MISMATCH" : "");
+        if (bad) return 1;
+    }
+    fclose(f);
+    return sink == 0xFFFFFFFF;   // Keeps the copies from being optimised out
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && strcmp(argv[1], "--pack") == 0) return packBench(argv[2]);
+
+    const char* clipPath = nullptr;
+    const char* refPath = nullptr;
+    double fps = 30;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) fps = atof(argv[++i]);
+        else if (!clipPath) clipPath = argv[i];
+        else refPath = argv[i];
+    }
+    if (!clipPath) {
+        fprintf(stderr, "usage: %s clip.lfx [raw_lfx1_reference.lfx] [--fps N] | --pack clips.bin\n", argv[0]);
+        return 2;
+    }
+
+    MemoryReader reader;
+    if (!loadFile(clipPath, reader.data)) {
+        fprintf(stderr, "Cannot read %s\n", clipPath);
+        return 1;
+    }
+    LfxHeader header;
+    memcpy(&header, reader.data.data(), sizeof(header));
+    if (memcmp(header.magic, "LFX2", 4) != 0 || header.format != LFX_FORMAT_DELTA_RLE ||
+        header.width != 32 || header.height != 32) {
+        fprintf(stderr, "%s is not a 32x32 LFX2 clip\n", clipPath);
+        return 1;
+    }
+    uint16_t frames = header.frames;
+    LfxDecoder* decoder = new LfxDecoder();
+    if (!decoder->begin(reader, frames, reader.data.size())) {
+        fprintf(stderr, "%s: corrupt frame table\n", clipPath);
+        return 1;
+    }
+
+    uint32_t keys = 0, repeats = 0;
+    for (uint16_t i = 0; i < frames; i++) {
+        if (decoder->isKeyframe(i)) keys++;
+        else if (decoder->getFrameSize(i) == 0) repeats++;
+    }
+    size_t rawBytes = sizeof(LfxHeader) + (size_t)frames * LFX_FRAME_BYTES;
+    printf("%s: %u frames, %zu bytes vs %zu raw (%.1f%%, %.1fx)\n", clipPath, frames,
+           reader.data.size(), rawBytes, 100.0 * reader.data.size() / rawBytes,
+           (double)rawBytes / reader.data.size());
+    printf("  %u keyframes, %u deltas, %u repeats\n", keys, frames - keys - repeats, repeats);
+
+    uint8_t out[LFX_FRAME_BYTES];
+
+    // Reference check
+    if (refPath) {
+        std::vector<uint8_t> ref;
+        if (!loadFile(refPath, ref) || ref.size() != rawBytes || memcmp(ref.data(), "LFX1", 4) != 0) {
+            fprintf(stderr, "%s is not the matching LFX1 clip\n", refPath);
+            return 1;
+        }
+        uint32_t bad = 0;
+        for (uint16_t i = 0; i < frames; i++) {
+            decoder->decode(reader, i, out);
+            if (memcmp(out, ref.data() + sizeof(LfxHeader) + (size_t)i * LFX_FRAME_BYTES, LFX_FRAME_BYTES) != 0) bad++;
+        }
+        printf("  reference: %s (%u of %u frames differ)\n", bad ? "MISMATCH" : "match", bad, frames);
+        if (bad) return 1;
+    }
+
+    // Playback order, several passes
+    const uint32_t passes = frames < 1000 ? 10000 / frames + 1 : 1;
+    reader.bytesRead = 0;
+    uint64_t start = nowNs();
+    for (uint32_t p = 0; p < passes; p++) {
+        for (uint16_t i = 0; i < frames; i++) decoder->decode(reader, i, out);
+    }
+    double seqUs = (nowNs() - start) / 1000.0 / ((double)passes * frames);
+    double bytesPerFrame = (double)reader.bytesRead / ((double)passes * frames);
+    printf("  sequential: %.2f us/frame, %.0f bytes read/frame (%.1f KB/s at %.0f fps vs %.1f KB/s raw)\n",
+           seqUs, bytesPerFrame, bytesPerFrame * fps / 1024, fps, LFX_FRAME_BYTES * fps / 1024);
+
+    // Random seeks (restart from the keyframe before the target)
+    srand(1);
+    const uint32_t seeks = 2000;
+    uint64_t worst = 0, total = 0;
+    for (uint32_t s = 0; s < seeks; s++) {
+        uint16_t target = rand() % frames;
+        uint64_t t = nowNs();
+        decoder->decode(reader, target, out);
+        t = nowNs() - t;
+        total += t;
+        if (t > worst) worst = t;
+    }
+    printf("  random seek: avg %.2f us, worst %.2f us\n", total / 1000.0 / seeks, worst / 1000.0);
+
+    delete decoder;
+    return 0;
+}
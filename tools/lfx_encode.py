@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+"""Encode 32x32 animation frames into an LFX clip for FsFrameSource.
+
+By default writes a compressed LFX2 clip: keyframes plus XOR deltas against
+the previous frame, run-length encoded, with empty frames where nothing
+changed (format described in include/frame_io/LfxFormat.h). --raw writes an
+uncompressed LFX1 clip instead, and --indexed a palette-indexed one: 4 bits
+per pixel for up to 16 colors, 8 bits for up to 256, with one palette for the
+clip or, if the clip as a whole has more colors, one per frame.
+
+Input is an existing LFX1/LFX2 clip, an animated GIF/PNG/WebP, or a list of
+32x32 images played in order.
+
+Usage:
+    python lfx_encode.py clip.gif ../data/animations/clip.lfx
+    python lfx_encode.py frame*.png ../data/animations/clip.lfx
+    python lfx_encode.py old_raw.lfx ../data/animations/clip.lfx
+Options:
+    --keyframe N    keyframe at least every N frames (default 32, 0 = only
+                    the first); a seek decodes from the keyframe before it
+    --raw           write LFX1 (3072 bytes per frame)
+    --indexed       write palette-indexed LFX1 (1024 or 512 bytes per frame)
+
+Requires Pillow for image input (pip install pillow).
+"""
+
+import struct
+import sys
+
+SIZE = 32
+FRAME_BYTES = SIZE * SIZE * 3
+HEADER = '<4sHHHB'
+HEADER_BYTES = struct.calcsize(HEADER)
+FORMAT_RGB888 = 0
+FORMAT_DELTA_RLE = 1
+FORMAT_INDEXED8 = 2
+FORMAT_INDEXED4 = 3
+PALETTE_PER_FRAME = 0x01
+KEYFRAME = 0x80000000
+RUN = 0x80
+MAX_RUN = 128
+
+
+def encode_runs(data):
+    """data: frame bytes (raw or XORed). Returns the run list."""
+    pixels = [bytes(data[i:i + 3]) for i in range(0, len(data), 3)]
+    out = bytearray()
+    count = len(pixels)
+    x = 0
+    while x < count:
+        run = 1
+        while x + run < count and run < MAX_RUN and pixels[x + run] == pixels[x]:
+            run += 1
+        if run >= 2:
+            out += bytes((RUN | (run - 1),)) + pixels[x]
+            x += run
+            continue
+
+        # Literals up to the next pair of equal pixels
+        start = x
+        while x < count and x - start < MAX_RUN:
+            if x + 1 < count and pixels[x + 1] == pixels[x]:
+                break
+            x += 1
+        if x == start:
+            x += 1
+        out += bytes((x - start - 1,)) + b''.join(pixels[start:x])
+    return bytes(out)
+
+
+def encode_lfx2(frames, keyframe_every):
+    table = []
+    payload = bytearray()
+    previous = None
+    since_key = 0
+    data_start = HEADER_BYTES + 4 * (len(frames) + 1)
+    for frame in frames:
+        key_runs = encode_runs(frame)
+        use_key = previous is None or (keyframe_every and since_key >= keyframe_every)
+        runs = key_runs
+        if not use_key:
+            if frame == previous:
+                runs = b''     # Repeat the previous frame
+            else:
+                delta = encode_runs(bytes(a ^ b for a, b in zip(frame, previous)))
+                # Cuts are cheaper as keyframes, and shorten later seeks
+                if len(delta) < len(key_runs):
+                    runs = delta
+                else:
+                    use_key = True
+        since_key = 0 if use_key else since_key + 1
+        table.append((data_start + len(payload)) | (KEYFRAME if use_key else 0))
+        payload += runs
+        previous = frame
+    table.append(data_start + len(payload))
+
+    blob = bytearray(struct.pack(HEADER, b'LFX2', SIZE, SIZE, len(frames), FORMAT_DELTA_RLE))
+    blob += struct.pack('<%dI' % len(table), *table)
+    return bytes(blob + payload)
+
+
+def encode_lfx1(frames):
+    blob = struct.pack(HEADER, b'LFX1', SIZE, SIZE, len(frames), FORMAT_RGB888)
+    return blob + b''.join(frames)
+
+
+def palette_of(frames):
+    """Colors used by frames, in order of first use."""
+    colors = {}
+    for frame in frames:
+        for i in range(0, FRAME_BYTES, 3):
+            colors.setdefault(frame[i:i + 3], len(colors))
+    return colors
+
+
+def pack_indices(frame, colors, bits):
+    indices = [colors[frame[i:i + 3]] for i in range(0, FRAME_BYTES, 3)]
+    if bits == 8:
+        return bytes(indices)
+    return bytes((indices[i] << 4) | indices[i + 1] for i in range(0, len(indices), 2))
+
+
+def encode_indexed(frames):
+    colors = palette_of(frames)
+    per_frame = None
+    if len(colors) > 256:
+        per_frame = [palette_of([frame]) for frame in frames]
+        count = max(len(p) for p in per_frame)
+        if count > 256:
+            raise ValueError('a frame has %d colors, more than 256' % count)
+    else:
+        count = len(colors)
+    bits = 4 if count <= 16 else 8
+
+    fmt = FORMAT_INDEXED4 if bits == 4 else FORMAT_INDEXED8
+    blob = bytearray(struct.pack(HEADER, b'LFX1', SIZE, SIZE, len(frames), fmt))
+    blob += struct.pack('<BB', count - 1, PALETTE_PER_FRAME if per_frame else 0)
+    if not per_frame:
+        blob += b''.join(colors)
+    for i, frame in enumerate(frames):
+        if per_frame:
+            # Padded so every frame has the same size
+            blob += b''.join(per_frame[i]) + bytes(3 * (count - len(per_frame[i])))
+            blob += pack_indices(frame, per_frame[i], bits)
+        else:
+            blob += pack_indices(frame, colors, bits)
+    return bytes(blob)
+
+
+def decode_lfx(blob):
+    """Frames of an existing clip (either version), for re-encoding."""
+    magic, width, height, count, fmt = struct.unpack_from(HEADER, blob)
+    if (width, height) != (SIZE, SIZE):
+        raise ValueError('clip is %dx%d, expected %dx%d' % (width, height, SIZE, SIZE))
+    if magic == b'LFX1' and fmt == FORMAT_RGB888:
+        return [blob[HEADER_BYTES + i * FRAME_BYTES:HEADER_BYTES + (i + 1) * FRAME_BYTES] for i in range(count)]
+    if magic == b'LFX1' and fmt in (FORMAT_INDEXED8, FORMAT_INDEXED4):
+        colors, flags = struct.unpack_from('<BB', blob, HEADER_BYTES)
+        palette_bytes = 3 * (colors + 1)
+        index_bytes = SIZE * SIZE if fmt == FORMAT_INDEXED8 else SIZE * SIZE // 2
+        at = HEADER_BYTES + 2
+        palette = blob[at:at + palette_bytes]
+        if not flags & PALETTE_PER_FRAME:
+            at += palette_bytes
+        frames = []
+        for i in range(count):
+            if flags & PALETTE_PER_FRAME:
+                palette = blob[at:at + palette_bytes]
+                at += palette_bytes
+            packed = blob[at:at + index_bytes]
+            at += index_bytes
+            if fmt == FORMAT_INDEXED4:
+                indices = [n for b in packed for n in (b >> 4, b & 0x0F)]
+            else:
+                indices = packed
+            frames.append(b''.join(palette[k * 3:k * 3 + 3] for k in indices))
+        return frames
+    if magic != b'LFX2' or fmt != FORMAT_DELTA_RLE:
+        raise ValueError('unknown LFX version')
+
+    table = struct.unpack_from('<%dI' % (count + 1), blob, HEADER_BYTES)
+    frames = []
+    frame = bytearray(FRAME_BYTES)
+    for i in range(count):
+        at, end = table[i] & ~KEYFRAME, table[i + 1] & ~KEYFRAME
+        if i == 0 or table[i] & KEYFRAME:
+            frame = bytearray(FRAME_BYTES)
+        pos = 0
+        while at < end:
+            control = blob[at]
+            n = (control & (RUN - 1)) + 1
+            if control & RUN:
+                pixel = blob[at + 1:at + 4]
+                for p in range(pos, pos + n):
+                    for c in range(3):
+                        frame[p * 3 + c] ^= pixel[c]
+                at += 4
+            else:
+                for k in range(n * 3):
+                    frame[pos * 3 + k] ^= blob[at + 1 + k]
+                at += 1 + n * 3
+            pos += n
+        frames.append(bytes(frame))
+    return frames
+
+
+def load_images(paths):
+    from PIL import Image, ImageSequence   # Only needed for image input
+
+    frames = []
+    for path in paths:
+        image = Image.open(path)
+        for still in ImageSequence.Iterator(image):
+            rgb = still.convert('RGB')
+            if rgb.size != (SIZE, SIZE):
+                raise ValueError('%s is %dx%d, expected %dx%d' % (path, rgb.size[0], rgb.size[1], SIZE, SIZE))
+            frames.append(rgb.tobytes())
+    return frames
+
+
+def main():
+    args = sys.argv[1:]
+    keyframe_every = 32
+    raw = False
+    indexed = False
+    positional = []
+    while args:
+        arg = args.pop(0)
+        if arg == '--keyframe':
+            keyframe_every = int(args.pop(0))
+        elif arg == '--raw':
+            raw = True
+        elif arg == '--indexed':
+            indexed = True
+        else:
+            positional.append(arg)
+    if len(positional) < 2:
+        print(__doc__)
+        return 1
+    inputs, output = positional[:-1], positional[-1]
+
+    try:
+        if len(inputs) == 1 and inputs[0].lower().endswith('.lfx'):
+            with open(inputs[0], 'rb') as f:
+                frames = decode_lfx(f.read())
+        else:
+            frames = load_images(inputs)
+        if not frames or len(frames) > 0xFFFF:
+            raise ValueError('need 1 to 65535 frames, got %d' % len(frames))
+        if raw:
+            blob = encode_lfx1(frames)
+        elif indexed:
+            blob = encode_indexed(frames)
+        else:
+            blob = encode_lfx2(frames, keyframe_every)
+    except ValueError as e:
+        print('%s: %s' % (inputs[0], e), file=sys.stderr)
+        return 1
+
+    with open(output, 'wb') as f:
+        f.write(blob)
+    raw_bytes = HEADER_BYTES + len(frames) * FRAME_BYTES
+    print('%s: %d frames, %d bytes (%d%% of raw RGB)'
+          % (output, len(frames), len(blob), 100 * len(blob) // raw_bytes))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
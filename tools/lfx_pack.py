@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Pack LFX clips into an image for the raw "clips" flash partition.
+
+The firmware maps the partition into memory (ClipPartition) and registers
+each clip as a frame animation under its name, playing raw RGB888 clips in
+place without any flash reads or copies. Indexed and LFX2 clips work too, but
+are expanded or decoded per frame.
+
+Image layout (see include/frame_io/ClipPartition.h): "LFXP", version, clip
+count, then one 36-byte directory entry per clip (name, offset, size, frame
+delay), then the clips, each starting on a 16-byte boundary.
+
+Usage:
+    python lfx_pack.py clips.bin fire.lfx text.lfx:80 name=logo.lfx
+    esptool.py --chip esp32s3 write_flash <offset> clips.bin
+Arguments:
+    [name=]path[:ms]    clip file, optional name (default: file name without
+                        extension, up to 23 characters) and frame delay
+                        (default 100 ms)
+Options:
+    --partitions csv    partition table to check the size against and take
+                        the flash offset from (default ../partitions_16MB_clips.csv)
+"""
+
+import os
+import struct
+import sys
+
+ALIGN = 16
+NAME_BYTES = 24
+ENTRY = '<%dsIIHH' % NAME_BYTES
+LABEL = 'clips'
+
+
+def parse_clip(arg):
+    name = None
+    if '=' in arg:
+        name, arg = arg.split('=', 1)
+    delay = 100
+    path, sep, ms = arg.rpartition(':')
+    if sep and ms.isdigit():
+        delay = int(ms)
+    else:
+        path = arg
+    if not name:
+        name = os.path.splitext(os.path.basename(path))[0]
+    if len(name.encode()) >= NAME_BYTES:
+        raise ValueError('clip name "%s" is longer than %d bytes' % (name, NAME_BYTES - 1))
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] not in (b'LFX1', b'LFX2'):
+        raise ValueError('%s is not an LFX clip' % path)
+    return name, delay, data
+
+
+def pack(clips):
+    header_bytes = 8 + struct.calcsize(ENTRY) * len(clips)
+    offset = (header_bytes + ALIGN - 1) // ALIGN * ALIGN
+    directory = bytearray(struct.pack('<4sHH', b'LFXP', 1, len(clips)))
+    body = bytearray()
+    for name, delay, data in clips:
+        directory += struct.pack(ENTRY, name.encode(), offset + len(body), len(data), delay, 0)
+        body += data + bytes(-len(data) % ALIGN)
+    return bytes(directory + bytes(offset - len(directory)) + body)
+
+
+def find_partition(csv_path):
+    """(offset, size) of the clips partition, or None."""
+    with open(csv_path) as f:
+        for line in f:
+            fields = [x.strip() for x in line.split('#')[0].split(',')]
+            if len(fields) >= 5 and fields[0] == LABEL:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
+
+
+def main():
+    args = sys.argv[1:]
+    csv_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'partitions_16MB_clips.csv')
+    positional = []
+    while args:
+        arg = args.pop(0)
+        if arg == '--partitions':
+            csv_path = args.pop(0)
+        else:
+            positional.append(arg)
+    if len(positional) < 2:
+        print(__doc__)
+        return 1
+
+    try:
+        clips = [parse_clip(arg) for arg in positional[1:]]
+        names = [name for name, _, _ in clips]
+        for name in names:
+            if names.count(name) > 1:
+                raise ValueError('two clips are named "%s"; rename one with name=path' % name)
+    except (OSError, ValueError) as e:
+        print(e, file=sys.stderr)
+        return 1
+    image = pack(clips)
+
+    partition = find_partition(csv_path) if os.path.exists(csv_path) else None
+    if partition and len(image) > partition[1]:
+        print('%d bytes do not fit the %d KB clips partition' % (len(image), partition[1] // 1024), file=sys.stderr)
+        return 1
+    with open(positional[0], 'wb') as f:
+        f.write(image)
+    print('%s: %d clips, %d KB' % (positional[0], len(clips), len(image) // 1024))
+    if partition:
+        print('Flash with: esptool.py --chip esp32s3 write_flash 0x%x %s' % (partition[0], positional[0]))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
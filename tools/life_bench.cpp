@@ -0,0 +1,65 @@
+// Host-side benchmark for the bit-packed cellular automaton (LifeAnimation).
+//
+// For each rule, seeds a board, runs the word-at-a-time step() and the
+// cell-by-cell stepNaive() reference side by side and checks that every
+// generation matches, then times both on the same board.
+//
+// Build (from the repository root; tools/host stands in for Arduino/FastLED):
+//     g++ -std=c++17 -O2 -Itools/host -Iinclude tools/life_bench.cpp -o life_bench
+// Usage:
+//     ./life_bench [generations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "animations/LifeAnimation.h"
+
+static bool sameBoard(const LifeAnimation& a, const LifeAnimation& b) {
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            if (a.isAlive(x, y) != b.isAlive(x, y)) return false;
+        }
+    }
+    return true;
+}
+
+static int bench(const char* rule, uint32_t generations) {
+    LifeAnimation packed(rule);
+    packed.setup();
+    LifeAnimation naive = packed;
+
+    // Correctness: compare every generation
+    for (uint32_t g = 0; g < 500; g++) {
+        packed.step();
+        naive.stepNaive();
+        if (!sameBoard(packed, naive)) {
+            printf("  %-12s MISMATCH at generation %u\n", rule, g + 1);
+            return 1;
+        }
+    }
+
+    // Speed, from the same board
+    LifeAnimation start = packed;
+    unsigned long t0 = micros();
+    for (uint32_t g = 0; g < generations; g++) packed.step();
+    double packedUs = (double)(micros() - t0) / generations;
+
+    naive = start;
+    t0 = micros();
+    for (uint32_t g = 0; g < generations; g++) naive.stepNaive();
+    double naiveUs = (double)(micros() - t0) / generations;
+
+    printf("  %-12s 500 generations match; bit-packed %6.2f us/gen, naive %7.2f us/gen (%.1fx)\n",
+           rule, packedUs, naiveUs, naiveUs / packedUs);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t generations = argc > 1 ? atoi(argv[1]) : 20000;
+    if (generations == 0) generations = 1;
+    printf("%ux%u toroidal board, %u words per row:\n", TOTAL_SIZE, TOTAL_SIZE, LIFE_WORDS);
+    const char* rules[] = { "B3/S23", "B36/S23", "B2/S", "B3678/S34678" };
+    for (const char* rule : rules) {
+        if (bench(rule, generations)) return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+// Host-side benchmark for the incremental noise field (NoiseField).
+//
+// Runs NoiseField::benchmark(), the same comparison the firmware can print:
+// single-octave updates of the field, advancing time by 1/16 lattice cell per
+// frame, against per-pixel inoise8 calls over the same 32x32 grid.
+//
+// Build (from the repository root; tools/host stands in for Arduino/FastLED,
+// with inoise8 ported from FastLED's portable C implementation):
+//     g++ -std=c++17 -O2 -Itools/host -Iinclude tools/noise_bench.cpp src/NoiseField.cpp -o noise_bench
+// Usage:
+//     ./noise_bench [frames]
+
+#include <stdlib.h>
+#include "render/NoiseField.h"
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 10000;
+    if (frames < 1 || frames > 65535) frames = 10000;
+    NoiseField::benchmark((uint16_t)frames);
+    return 0;
+}
@@ -0,0 +1,57 @@
+// Host-side benchmark for the particle engine (ParticleAnimation).
+//
+// Runs each effect through renderFrame() at 60 fps frame times and reports the
+// average live particle count, the time per frame, and particles per
+// millisecond, both for the whole frame (spawn, integrate, cull, fade and
+// splat) and for the update pass alone as the animation measures it. The
+// firmware prints the same update figure on its stats line (statsIntervalMs).
+//
+// Build (from the repository root; tools/host stands in for Arduino/FastLED):
+//     g++ -std=c++17 -O2 -Itools/host -Iinclude tools/particle_bench.cpp -o particle_bench
+// Usage:
+//     ./particle_bench [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "animations/ParticleAnimation.h"
+
+static CRGB canvas[TOTAL_SIZE][TOTAL_SIZE];
+static ParticleAnimation fireworks(PARTICLES_FIREWORKS);
+static ParticleAnimation snow(PARTICLES_SNOW);
+static ParticleAnimation sparks(PARTICLES_SPARKS);
+
+static void bench(ParticleAnimation& anim, uint32_t frames) {
+    anim.setup();
+    uint32_t frameTime = 0;
+    for (uint32_t i = 0; i < 300; i++) {    // Let the pool fill up
+        frameTime += 16;
+        anim.renderFrame(canvas, frameTime);
+    }
+
+    uint64_t particles = 0, frameUs = 0;
+    uint32_t peak = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        frameTime += 16;
+        unsigned long start = micros();
+        anim.renderFrame(canvas, frameTime);
+        frameUs += micros() - start;
+        particles += anim.getParticleCount();
+        if (anim.getParticleCount() > peak) peak = anim.getParticleCount();
+    }
+    char detail[128];
+    anim.formatStats(detail, sizeof(detail));
+    printf("  %-10s avg %5.0f particles (peak %4u / %u), %7.2f us/frame, %6.0f particles/ms per frame\n",
+           anim.getName(), (double)particles / frames, peak, PARTICLE_CAPACITY,
+           (double)frameUs / frames, frameUs ? particles * 1000.0 / frameUs : 0.0);
+    printf("  %-10s last frame: %s\n", "", detail);
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = argc > 1 ? atoi(argv[1]) : 5000;
+    if (frames == 0) frames = 1;
+    printf("Particle engine, %u frames per effect:\n", frames);
+    bench(fireworks, frames);
+    bench(snow, frames);
+    bench(sparks, frames);
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Host-side benchmark for the pixel-shader VM (PixelShader, tools/shader_compile.py).
+//
+// Renders compiled shader programs and the native C++ animations they stand in
+// for through the same renderFrame() calls, and reports the time per 32x32
+// frame, the share of a 30 fps frame budget it would take at that speed, and
+// how many distinct colours the last frame held (1 means the program renders
+// a flat colour, which is almost always a bug in the expression).
+//
+// Build (from the repository root; tools/host stands in for Arduino/FastLED):
+//     g++ -std=c++17 -O2 -Itools/host -Iinclude tools/shader_bench.cpp src/PixelShader.cpp src/NoiseField.cpp -o shader_bench
+// Usage:
+//     python tools/shader_compile.py tools/shaders/lava.shd lava.psb
+//     ./shader_bench lava.psb plasma.psb [--frames N]
+
+#include <set>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "animations/NoiseAnimation.h"
+#include "animations/RainbowAnimation.h"
+#include "animations/ShaderAnimation.h"
+
+static CRGB canvas[TOTAL_SIZE][TOTAL_SIZE];
+
+static void bench(Animation* anim, const char* label, uint32_t frames) {
+    anim->setup();
+    uint32_t frameTime = 0;
+    anim->renderFrame(canvas, frameTime);   // Warm up
+    unsigned long start = micros();
+    for (uint32_t i = 0; i < frames; i++) {
+        frameTime += 33;
+        anim->renderFrame(canvas, frameTime);
+    }
+    double us = (double)(micros() - start) / frames;
+
+    std::set<uint32_t> colours;
+    for (uint8_t y = 0; y < TOTAL_SIZE; y++) {
+        for (uint8_t x = 0; x < TOTAL_SIZE; x++) {
+            colours.insert((canvas[y][x].r << 16) | (canvas[y][x].g << 8) | canvas[y][x].b);
+        }
+    }
+    printf("  %-22s %8.2f us/frame  %5.2f%% of 30 fps  %4zu colours%s\n", label, us,
+           us / 333.33, colours.size(), colours.size() == 1 ? "  FLAT" : "");
+}
+
+int main(int argc, char** argv) {
+    uint32_t frames = 2000;
+    int shaders = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) frames = atoi(argv[++i]);
+        else shaders++;
+    }
+    if (shaders == 0) {
+        fprintf(stderr, "usage: %s program.psb [...] [--frames N]\n", argv[0]);
+        return 2;
+    }
+
+    printf("Native animations:\n");
+    RainbowAnimation rainbow;
+    bench(&rainbow, "Rainbow", frames);
+    NoiseAnimation lava(NOISE_LAVA);
+    bench(&lava, "Noise Lava", frames);
+    NoiseAnimation clouds(NOISE_CLOUDS);
+    bench(&clouds, "Noise Clouds", frames);
+
+    printf("Shader programs:\n");
+    int failed = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--frames") == 0) { i++; continue; }
+        ShaderAnimation shader(argv[i], argv[i]);
+        if (!shader.isValid()) {
+            failed++;
+            continue;
+        }
+        bench(&shader, argv[i], frames);
+    }
+    return failed ? 1 : 0;
+}
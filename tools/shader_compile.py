@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+"""Compile a pixel-shader expression file (.shd) to PSH1 bytecode (.psb).
+
+The output is loaded by PixelShader / ShaderAnimation from /shaders on LittleFS.
+
+Language (one statement per line, '#' starts a comment):
+
+    palette rainbow                      # default hue wheel
+    palette 0:000000 128:ff4000 255:ffff00   # gradient stops index:rrggbb
+    table 128 + 127 * sin(i / 256)       # optional lut() table, i = 0..255
+    symmetry 4                           # optional: h, v, 4 or 8 (see below)
+    let a = sin(x / 16 + t / 4)          # named sub-expression
+    out 128 + 64 * (a + sin(y / 8 - t))  # palette position (0..255, wraps)
+
+Inputs: x, y (pixel coordinates), t (seconds).
+Operators: + - * / % and unary minus. Builtins: sin(v), cos(v) (v in turns,
+1.0 = full circle), noise(a, b), noise(a, b, c) (0..1, one lattice cell per
+1.0), min, max, abs, frac, lut(v) (table entry int(v) & 255, so scale 0..1
+values such as noise by 255 first).
+
+With a symmetry declared, only the fundamental region is evaluated (left half,
+top half, top-left quadrant, or its x >= y triangle for 8) and the rest of the
+canvas is mirrored from it.
+
+All arithmetic is Q8.8 fixed point. Sub-expressions that depend only on t are
+hoisted into the per-frame segment, those that depend on y (and t) into the
+per-row segment, so the per-pixel code only evaluates what depends on x.
+
+Usage: python shader_compile.py plasma.shd ../data/shaders/plasma.psb
+"""
+
+import math
+import re
+import struct
+import sys
+
+OPS = {
+    'CONST': 1, 'X': 2, 'Y': 3, 'T': 4, 'LOAD': 5, 'STORE': 6,
+    'ADD': 7, 'SUB': 8, 'MUL': 9, 'DIV': 10, 'MOD': 11, 'NEG': 12,
+    'MIN': 13, 'MAX': 14, 'ABS': 15, 'FRAC': 16, 'SIN': 17, 'COS': 18,
+    'NOISE2': 19, 'NOISE3': 20, 'LUT': 21,
+}
+BINOPS = {'+': 'ADD', '-': 'SUB', '*': 'MUL', '/': 'DIV', '%': 'MOD'}
+FUNCS = {'sin': (1, 'SIN'), 'cos': (1, 'COS'), 'abs': (1, 'ABS'), 'frac': (1, 'FRAC'),
+         'lut': (1, 'LUT'), 'min': (2, 'MIN'), 'max': (2, 'MAX')}
+INPUT_LEVEL = {'t': 1, 'y': 2, 'x': 3}   # frame, row, pixel
+SYMMETRY = {'none': 0, 'h': 1, 'v': 2, '4': 3, '8': 7}   # RenderSymmetry values
+MAX_REGS = 32
+
+
+class CompileError(Exception):
+    pass
+
+
+# ---------------------------------------------------------------- parsing
+
+def tokenize(text):
+    tokens = re.findall(r'\d+\.\d*|\.\d+|\d+|[A-Za-z_]\w*|[-+*/%(),]', text)
+    if ''.join(tokens) != re.sub(r'\s+', '', text):
+        raise CompileError('unexpected character in: ' + text)
+    return tokens
+
+
+class Parser:
+    def __init__(self, text, names, inputs):
+        self.tokens = tokenize(text)
+        self.pos = 0
+        self.names = names
+        self.inputs = inputs
+
+    def peek(self):
+        return self.tokens[self.pos] if self.pos < len(self.tokens) else None
+
+    def take(self, expected=None):
+        tok = self.peek()
+        if tok is None or (expected and tok != expected):
+            raise CompileError('expected %s, got %s' % (expected or 'token', tok))
+        self.pos += 1
+        return tok
+
+    def parse(self):
+        node = self.expr()
+        if self.peek() is not None:
+            raise CompileError('unexpected ' + self.peek())
+        return node
+
+    def expr(self):
+        node = self.term()
+        while self.peek() in ('+', '-'):
+            node = ('bin', self.take(), node, self.term())
+        return node
+
+    def term(self):
+        node = self.unary()
+        while self.peek() in ('*', '/', '%'):
+            node = ('bin', self.take(), node, self.unary())
+        return node
+
+    def unary(self):
+        if self.peek() == '-':
+            self.take()
+            return ('neg', self.unary())
+        return self.atom()
+
+    def atom(self):
+        tok = self.take()
+        if tok == '(':
+            node = self.expr()
+            self.take(')')
+            return node
+        if re.match(r'[\d.]', tok):
+            return ('num', int(round(float(tok) * 256)))
+        if tok in self.inputs:
+            return ('in', tok)
+        if tok in self.names:
+            return self.names[tok]
+        if tok in FUNCS or tok == 'noise':
+            self.take('(')
+            args = [self.expr()]
+            while self.peek() == ',':
+                self.take()
+                args.append(self.expr())
+            self.take(')')
+            if tok == 'noise':
+                if len(args) not in (2, 3):
+                    raise CompileError('noise takes 2 or 3 arguments')
+                return ('call', 'NOISE%d' % len(args), tuple(args))
+            if len(args) != FUNCS[tok][0]:
+                raise CompileError('%s takes %d argument(s)' % (tok, FUNCS[tok][0]))
+            return ('call', FUNCS[tok][1], tuple(args))
+        raise CompileError('unknown name: ' + tok)
+
+
+# ---------------------------------------------------------- constant folding
+
+def fold(node):
+    kind = node[0]
+    if kind == 'neg':
+        inner = fold(node[1])
+        return ('num', -inner[1]) if inner[0] == 'num' else ('neg', inner)
+    if kind == 'bin':
+        op, a, b = node[1], fold(node[2]), fold(node[3])
+        if a[0] == 'num' and b[0] == 'num':
+            x, y = a[1], b[1]
+            if op == '+': return ('num', x + y)
+            if op == '-': return ('num', x - y)
+            if op == '*': return ('num', (x * y) >> 8)
+            if op == '/' and y: return ('num', int((x << 8) / y))
+            if op == '%' and y: return ('num', int(math.fmod(x, y)))
+        # Division by a power-of-two constant becomes an exact multiply
+        if op == '/' and b[0] == 'num' and b[1] > 0 and (65536 % b[1]) == 0:
+            return ('bin', '*', a, ('num', 65536 // b[1]))
+        return ('bin', op, a, b)
+    if kind == 'call':
+        return ('call', node[1], tuple(fold(arg) for arg in node[2]))
+    return node
+
+
+def level(node):
+    kind = node[0]
+    if kind == 'num':
+        return 0
+    if kind == 'in':
+        return INPUT_LEVEL[node[1]]
+    if kind == 'neg':
+        return level(node[1])
+    if kind == 'bin':
+        return max(level(node[2]), level(node[3]))
+    # Builtins with constant arguments still run once, in the frame segment
+    return max([1] + [level(arg) for arg in node[2]])
+
+
+# ---------------------------------------------------------- code generation
+
+class CodeGen:
+    def __init__(self):
+        self.segments = {1: bytearray(), 2: bytearray(), 3: bytearray()}
+        self.registers = {}
+
+    def emit(self, seg, op, operand=None):
+        out = self.segments[seg]
+        out.append(OPS[op])
+        if op == 'CONST':
+            out += struct.pack('<i', operand)
+        elif operand is not None:
+            out.append(operand)
+
+    def gen(self, node, seg):
+        kind = node[0]
+        node_level = level(node)
+
+        # Loop-invariant sub-expression: compute once in its own segment
+        if kind not in ('num', 'in') and node_level < seg:
+            if node not in self.registers:
+                if len(self.registers) >= MAX_REGS:
+                    raise CompileError('too many hoisted sub-expressions')
+                home = max(node_level, 1)
+                self.gen(node, home)
+                reg = len(self.registers)
+                self.registers[node] = reg
+                self.emit(home, 'STORE', reg)
+            self.emit(seg, 'LOAD', self.registers[node])
+            return
+
+        if kind == 'num':
+            self.emit(seg, 'CONST', node[1])
+        elif kind == 'in':
+            self.emit(seg, node[1].upper())
+        elif kind == 'neg':
+            self.gen(node[1], seg)
+            self.emit(seg, 'NEG')
+        elif kind == 'bin':
+            self.gen(node[2], seg)
+            self.gen(node[3], seg)
+            self.emit(seg, BINOPS[node[1]])
+        else:
+            for arg in node[2]:
+                self.gen(arg, seg)
+            self.emit(seg, node[1])
+
+
+# ---------------------------------------------------------- table evaluation
+
+def eval_table(node, i):
+    kind = node[0]
+    if kind == 'num':
+        return node[1] / 256.0
+    if kind == 'in':
+        return float(i)
+    if kind == 'neg':
+        return -eval_table(node[1], i)
+    if kind == 'bin':
+        a, b = eval_table(node[2], i), eval_table(node[3], i)
+        return {'+': a + b, '-': a - b, '*': a * b,
+                '/': a / b if b else 0.0, '%': math.fmod(a, b) if b else 0.0}[node[1]]
+    args = [eval_table(arg, i) for arg in node[2]]
+    fn = node[1]
+    if fn == 'SIN': return math.sin(args[0] * 2 * math.pi)
+    if fn == 'COS': return math.cos(args[0] * 2 * math.pi)
+    if fn == 'ABS': return abs(args[0])
+    if fn == 'FRAC': return args[0] - math.floor(args[0])
+    if fn == 'MIN': return min(args)
+    if fn == 'MAX': return max(args)
+    raise CompileError('%s is not available in table expressions' % fn.lower())
+
+
+# ---------------------------------------------------------------- driver
+
+def parse_palette(args):
+    if args == ['rainbow']:
+        return []
+    stops = []
+    for item in args:
+        m = re.match(r'^(\d+):([0-9a-fA-F]{6})$', item)
+        if not m:
+            raise CompileError('bad palette stop: ' + item)
+        rgb = bytes.fromhex(m.group(2))
+        stops.append((int(m.group(1)), rgb[0], rgb[1], rgb[2]))
+    if not stops or stops[0][0] != 0 or stops[-1][0] != 255:
+        raise CompileError('palette stops must start at 0 and end at 255')
+    if any(a[0] >= b[0] for a, b in zip(stops, stops[1:])):
+        raise CompileError('palette stops must be ascending')
+    return stops
+
+
+def compile_source(source):
+    names = {}
+    stops = []
+    table = None
+    symmetry = 0
+    out = None
+
+    for lineno, raw in enumerate(source.splitlines(), 1):
+        line = raw.split('#', 1)[0].strip()
+        if not line:
+            continue
+        try:
+            keyword, _, rest = line.partition(' ')
+            if keyword == 'palette':
+                stops = parse_palette(rest.split())
+            elif keyword == 'table':
+                tree = Parser(rest, {}, ('i',)).parse()
+                table = [max(-32768, min(32767, int(round(eval_table(tree, i) * 256))))
+                         for i in range(256)]
+            elif keyword == 'symmetry':
+                if rest.strip() not in SYMMETRY:
+                    raise CompileError('symmetry must be one of: ' + ', '.join(SYMMETRY))
+                symmetry = SYMMETRY[rest.strip()]
+            elif keyword == 'let':
+                name, eq, expr = rest.partition('=')
+                name = name.strip()
+                if not eq or not re.match(r'^[A-Za-z_]\w*$', name):
+                    raise CompileError('expected: let name = expr')
+                names[name] = Parser(expr, names, INPUT_LEVEL).parse()
+            elif keyword == 'out':
+                out = Parser(rest, names, INPUT_LEVEL).parse()
+            else:
+                raise CompileError('unknown statement: ' + keyword)
+        except CompileError as e:
+            raise CompileError('line %d: %s' % (lineno, e))
+
+    if out is None:
+        raise CompileError('missing "out" statement')
+
+    gen = CodeGen()
+    gen.gen(fold(out), 3)
+    frame, row, pixel = gen.segments[1], gen.segments[2], gen.segments[3]
+    if len(frame) + len(row) + len(pixel) > 1024:
+        raise CompileError('program too large (%d bytes)' % (len(frame) + len(row) + len(pixel)))
+
+    blob = bytearray()
+    flags = (1 if table else 0) | (symmetry << 1)
+    blob += struct.pack('<4sBBHHHBB', b'PSH1', len(gen.registers), flags,
+                        len(frame), len(row), len(pixel), len(stops), 0)
+    for stop in stops:
+        blob += bytes(stop)
+    if table:
+        blob += struct.pack('<256h', *table)
+    blob += frame + row + pixel
+    return bytes(blob), (len(frame), len(row), len(pixel), len(gen.registers))
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+    with open(sys.argv[1]) as f:
+        source = f.read()
+    try:
+        blob, (frame, row, pixel, regs) = compile_source(source)
+    except CompileError as e:
+        print('%s: %s' % (sys.argv[1], e), file=sys.stderr)
+        return 1
+    with open(sys.argv[2], 'wb') as f:
+        f.write(blob)
+    print('%s: %d bytes (frame %d, row %d, pixel %d code bytes, %d registers)'
+          % (sys.argv[2], len(blob), frame, row, pixel, regs))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""Encode a PNG sprite strip into an RLE, color-keyed sprite sheet (SPR1).
+
+The output is loaded by SpriteSheet (from /sprites on LittleFS) or, with
+--header, compiled into the firmware as a PROGMEM array.
+
+Frames are laid out left to right in the image, each --frame-width pixels wide
+(default: the image height, i.e. square frames). Pixels equal to the key color,
+or with alpha below 128, are transparent.
+
+Usage:
+    python sprite_encode.py strip.png ../data/sprites/strip.spr
+    python sprite_encode.py strip.png strip.h --header SPRITE_STRIP
+Options:
+    --frame-width N     width of one frame in pixels
+    --key rrggbb        transparent color (default ff00ff)
+
+Requires Pillow for reading PNGs (pip install pillow).
+"""
+
+import struct
+import sys
+
+SOLID = 0x80
+MAX_SPAN = 0x7F
+MIN_SOLID = 3   # Shorter repeats are cheaper as literals
+
+
+def encode_row(row):
+    """row: list of (r, g, b) or None for transparent. Returns the encoded row."""
+    spans = []
+    x = 0
+    width = len(row)
+    while x < width:
+        skip = 0
+        while x < width and row[x] is None:
+            x += 1
+            skip += 1
+        if x >= width:
+            break
+        if skip > 255:
+            raise ValueError('transparent gap wider than 255 pixels')
+
+        # Solid span if the color repeats enough
+        run = 1
+        while x + run < width and run < MAX_SPAN and row[x + run] == row[x]:
+            run += 1
+        if run >= MIN_SOLID:
+            spans.append(bytes((skip, SOLID | run)) + bytes(row[x]))
+            x += run
+            continue
+
+        # Literal span until transparency or the next solid run
+        start = x
+        while x < width and row[x] is not None and x - start < MAX_SPAN:
+            repeat = 1
+            while x + repeat < width and repeat < MIN_SOLID and row[x + repeat] == row[x]:
+                repeat += 1
+            if repeat >= MIN_SOLID and x > start:
+                break
+            x += 1
+        spans.append(bytes((skip, x - start)) + b''.join(bytes(p) for p in row[start:x]))
+
+    if len(spans) > 255:
+        raise ValueError('row has too many spans')
+    return bytes((len(spans),)) + b''.join(spans)
+
+
+def encode(frames, width, height, key=(255, 0, 255)):
+    """frames: list of frames, each a list of rows of (r, g, b) or None."""
+    blob = bytearray(struct.pack('<4sHHH3BB', b'SPR1', width, height, len(frames), *key, 0))
+    table_pos = len(blob)
+    blob += bytes(4 * len(frames))
+
+    for index, frame in enumerate(frames):
+        frame_start = len(blob)
+        struct.pack_into('<I', blob, table_pos + 4 * index, frame_start)
+        rows = [encode_row(row) for row in frame]
+        offset = 2 * height
+        for row in rows:
+            if offset > 0xFFFF:
+                raise ValueError('frame too large')
+            blob += struct.pack('<H', offset)
+            offset += len(row)
+        for row in rows:
+            blob += row
+    return bytes(blob)
+
+
+def load_png(path, frame_width, key):
+    from PIL import Image   # Only needed for PNG input
+
+    image = Image.open(path).convert('RGBA')
+    width, height = image.size
+    frame_width = frame_width or height
+    if width % frame_width:
+        raise ValueError('image width %d is not a multiple of the frame width %d' % (width, frame_width))
+
+    pixels = image.load()
+    frames = []
+    for f in range(width // frame_width):
+        frame = []
+        for y in range(height):
+            row = []
+            for x in range(f * frame_width, (f + 1) * frame_width):
+                r, g, b, a = pixels[x, y]
+                row.append(None if a < 128 or (r, g, b) == key else (r, g, b))
+            frame.append(row)
+        frames.append(frame)
+    return frames, frame_width, height
+
+
+def to_header(blob, name, source):
+    lines = ['// Generated by tools/sprite_encode.py from %s - do not edit' % source,
+             '#pragma once', '#include <Arduino.h>', '',
+             'static const uint8_t %s[] PROGMEM = {' % name]
+    for i in range(0, len(blob), 16):
+        lines.append('    ' + ', '.join('0x%02x' % b for b in blob[i:i + 16]) + ',')
+    lines += ['};', 'static const size_t %s_SIZE = %d;' % (name, len(blob)), '']
+    return '\n'.join(lines)
+
+
+def main():
+    args = sys.argv[1:]
+    frame_width = 0
+    key = (255, 0, 255)
+    header = None
+    positional = []
+    while args:
+        arg = args.pop(0)
+        if arg == '--frame-width':
+            frame_width = int(args.pop(0))
+        elif arg == '--key':
+            key = tuple(bytes.fromhex(args.pop(0)))
+        elif arg == '--header':
+            header = args.pop(0)
+        else:
+            positional.append(arg)
+    if len(positional) != 2:
+        print(__doc__)
+        return 1
+
+    try:
+        frames, width, height = load_png(positional[0], frame_width, key)
+        blob = encode(frames, width, height, key)
+    except ValueError as e:
+        print('%s: %s' % (positional[0], e), file=sys.stderr)
+        return 1
+
+    if header:
+        with open(positional[1], 'w') as f:
+            f.write(to_header(blob, header, positional[0].replace('\\', '/').split('/')[-1]))
+    else:
+        with open(positional[1], 'wb') as f:
+            f.write(blob)
+    raw = len(frames) * width * height * 3
+    print('%s: %d frames of %dx%d, %d bytes (%d%% of raw RGB)'
+          % (positional[1], len(frames), width, height, len(blob), 100 * len(blob) // raw))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())